@@ -1,8 +1,8 @@
 /**
  * Postinstall binary downloader for claudev - Optimized C++ implementation
  *
- * Build: g++ -std=c++17 -O3 -o postinstall postinstall.cpp -lcurl -lz -larchive
- * Or:    clang++ -std=c++17 -O3 -o postinstall postinstall.cpp -lcurl -lz -larchive
+ * Build: g++ -std=c++17 -O3 -pthread -o postinstall postinstall.cpp -lcurl -lz -larchive
+ * Or:    clang++ -std=c++17 -O3 -pthread -o postinstall postinstall.cpp -lcurl -lz -larchive
  */
 
 #include <iostream>
@@ -15,6 +15,13 @@
 #include <memory>
 #include <system_error>
 #include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <curl/curl.h>
 #include <archive.h>
 #include <archive_entry.h>
@@ -34,6 +41,12 @@ constexpr std::string_view BINARY_NAME = "claudev";
 constexpr size_t DOWNLOAD_TIMEOUT = 60;
 constexpr size_t MAX_REDIRECTS = 5;
 constexpr size_t BUFFER_SIZE = 8192;
+constexpr size_t STREAM_READ_SIZE = 64 * 1024;       // libarchive read granularity
+constexpr size_t STREAM_PIPE_CAPACITY = 4 * 1024 * 1024;  // max bytes buffered between download and extract
+constexpr size_t SEGMENT_SIZE = 8 * 1024 * 1024;     // byte-range size per segmented request
+constexpr size_t MAX_CONNECTIONS = 4;                // concurrent connections for segmented downloads
+constexpr long STALL_SPEED_LIMIT = 1024;             // abort a transfer below 1 KB/s ...
+constexpr long STALL_SPEED_TIME = 30;                // ... sustained for 30s (replaces the hard total timeout)
 
 // Platform detection
 struct Platform {
@@ -115,147 +128,852 @@ public:
     CURL* get() noexcept { return handle_; }
 };
 
-// Download callback for libcurl
-struct DownloadBuffer {
-    std::vector<uint8_t> data;
+// Bounded byte pipe between the curl write callback (producer) and the
+// libarchive read callback (consumer). Capacity is fixed, so peak memory
+// stays at STREAM_PIPE_CAPACITY regardless of archive size, and extraction
+// overlaps the network transfer instead of waiting for it to finish.
+class StreamPipe {
+    std::mutex mutex_;
+    std::condition_variable can_write_;
+    std::condition_variable can_read_;
+    std::deque<uint8_t> buffer_;
+    bool closed_ = false;
+    bool aborted_ = false;
+
+public:
+    // Producer side: blocks while the pipe is full. Returns false if the
+    // consumer aborted (extraction error) so the download can stop early.
+    bool write(const uint8_t* data, size_t len) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        size_t written = 0;
+        while (written < len) {
+            can_write_.wait(lock, [this] {
+                return aborted_ || buffer_.size() < STREAM_PIPE_CAPACITY;
+            });
+            if (aborted_) return false;
+
+            size_t chunk = std::min(len - written, STREAM_PIPE_CAPACITY - buffer_.size());
+            buffer_.insert(buffer_.end(), data + written, data + written + chunk);
+            written += chunk;
+            can_read_.notify_one();
+        }
+        return true;
+    }
+
+    // Consumer side: blocks until data is available or the producer closed.
+    // Returns 0 on clean end-of-stream, -1 if the download failed.
+    ssize_t read(uint8_t* out, size_t max_len) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        can_read_.wait(lock, [this] { return closed_ || !buffer_.empty(); });
+
+        if (buffer_.empty()) {
+            return aborted_ ? -1 : 0;
+        }
+
+        size_t chunk = std::min(max_len, buffer_.size());
+        std::copy(buffer_.begin(), buffer_.begin() + chunk, out);
+        buffer_.erase(buffer_.begin(), buffer_.begin() + chunk);
+        can_write_.notify_one();
+        return static_cast<ssize_t>(chunk);
+    }
+
+    // Producer signals end of stream; on_error also poisons pending reads.
+    void close(bool on_error = false) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        if (on_error) {
+            aborted_ = true;
+            buffer_.clear();
+        }
+        can_read_.notify_all();
+        can_write_.notify_all();
+    }
+
+    // Consumer signals it no longer wants data (extraction failed).
+    void abort() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        aborted_ = true;
+        buffer_.clear();
+        can_read_.notify_all();
+        can_write_.notify_all();
+    }
+};
+
+// Download callback for libcurl: feeds the pipe instead of an in-memory buffer
+struct DownloadSink {
+    StreamPipe* pipe;
+    size_t total_bytes = 0;
     size_t last_reported_mb = 0;
 
     static size_t write_callback(void* contents, size_t size, size_t nmemb, void* userp) {
         size_t total_size = size * nmemb;
-        auto* buffer = static_cast<DownloadBuffer*>(userp);
+        auto* sink = static_cast<DownloadSink*>(userp);
 
         const auto* bytes = static_cast<const uint8_t*>(contents);
-        buffer->data.insert(buffer->data.end(), bytes, bytes + total_size);
+        if (!sink->pipe->write(bytes, total_size)) {
+            return 0; // Consumer aborted: make curl fail the transfer
+        }
+        sink->total_bytes += total_size;
 
         // Progress indicator (print every MB)
-        size_t current_mb = buffer->data.size() / (1024 * 1024);
-        if (current_mb > buffer->last_reported_mb) {
+        size_t current_mb = sink->total_bytes / (1024 * 1024);
+        if (current_mb > sink->last_reported_mb) {
             std::cout << "\r  Downloaded " << current_mb << " MB" << std::flush;
-            buffer->last_reported_mb = current_mb;
+            sink->last_reported_mb = current_mb;
         }
 
         return total_size;
     }
 };
 
-// Download file with redirect support
-std::optional<std::vector<uint8_t>> download_file(std::string_view url) {
+// libarchive read callback: pulls decompression input from the pipe
+struct ArchiveSource {
+    StreamPipe* pipe;
+    uint8_t buffer[STREAM_READ_SIZE];
+
+    static la_ssize_t read_callback(struct archive* a, void* client_data, const void** out) {
+        auto* source = static_cast<ArchiveSource*>(client_data);
+        la_ssize_t n = source->pipe->read(source->buffer, sizeof(source->buffer));
+        if (n < 0) {
+            archive_set_error(a, EIO, "download stream failed");
+            return -1;
+        }
+        *out = source->buffer;
+        return n;
+    }
+};
+
+// Extract all entries from an opened archive handle to dest_dir
+bool extract_entries(struct archive* a, struct archive* ext, const fs::path& dest_dir) {
+    struct archive_entry* entry;
+    bool success = true;
+    int r;
+
+    while (archive_read_next_header(a, &entry) == ARCHIVE_OK) {
+        // Construct full path
+        const char* current_file = archive_entry_pathname(entry);
+        fs::path full_path = dest_dir / current_file;
+
+        archive_entry_set_pathname(entry, full_path.c_str());
+
+        r = archive_write_header(ext, entry);
+        if (r != ARCHIVE_OK) {
+            std::cerr << "Write header failed: " << archive_error_string(ext) << std::endl;
+            success = false;
+            break;
+        }
+
+        // Copy data
+        const void* buff;
+        size_t size;
+        int64_t offset;
+
+        while ((r = archive_read_data_block(a, &buff, &size, &offset)) == ARCHIVE_OK) {
+            if (archive_write_data_block(ext, buff, size, offset) != ARCHIVE_OK) {
+                std::cerr << "Write data failed: " << archive_error_string(ext) << std::endl;
+                success = false;
+                break;
+            }
+        }
+
+        if (r != ARCHIVE_EOF) {
+            std::cerr << "Read data failed: " << archive_error_string(a) << std::endl;
+            success = false;
+            break;
+        }
+
+        r = archive_write_finish_entry(ext);
+        if (r != ARCHIVE_OK) {
+            std::cerr << "Finish entry failed: " << archive_error_string(ext) << std::endl;
+            success = false;
+            break;
+        }
+    }
+
+    return success;
+}
+
+// Consume the pipe through libarchive's streaming reader, extracting as bytes arrive
+bool extract_from_pipe(StreamPipe& pipe, const fs::path& dest_dir) {
+    struct archive* a = archive_read_new();
+    struct archive* ext = archive_write_disk_new();
+
+    if (!a || !ext) {
+        std::cerr << "Failed to create archive handles" << std::endl;
+        if (a) archive_read_free(a);
+        if (ext) archive_write_free(ext);
+        return false;
+    }
+
+    // Enable all formats and filters
+    archive_read_support_format_all(a);
+    archive_read_support_filter_all(a);
+
+    // Set extraction flags
+    int flags = ARCHIVE_EXTRACT_TIME | ARCHIVE_EXTRACT_PERM | ARCHIVE_EXTRACT_ACL | ARCHIVE_EXTRACT_FFLAGS;
+    archive_write_disk_set_options(ext, flags);
+    archive_write_disk_set_standard_lookup(ext);
+
+    ArchiveSource source{&pipe};
+    int r = archive_read_open(a, &source, nullptr, ArchiveSource::read_callback, nullptr);
+
+    bool success = false;
+    if (r != ARCHIVE_OK) {
+        std::cerr << "Failed to open archive stream: " << archive_error_string(a) << std::endl;
+    } else {
+        success = extract_entries(a, ext, dest_dir);
+    }
+
+    if (!success) {
+        pipe.abort(); // Unblock and stop the downloader
+    }
+
+    archive_read_close(a);
+    archive_read_free(a);
+    archive_write_close(ext);
+    archive_write_free(ext);
+
+    return success;
+}
+
+// Download and extract in one pipelined pass: curl feeds the pipe on this
+// thread while a worker extracts, so wall time is roughly
+// max(download, extract) and peak memory is the pipe capacity.
+bool download_and_extract(std::string_view url, const fs::path& dest_dir) {
     try {
         CurlHandle curl;
-        DownloadBuffer buffer;
+        StreamPipe pipe;
+        DownloadSink sink{&pipe};
+
+        bool extract_ok = false;
+        std::thread extractor([&] {
+            extract_ok = extract_from_pipe(pipe, dest_dir);
+        });
 
         curl_easy_setopt(curl.get(), CURLOPT_URL, url.data());
         curl_easy_setopt(curl.get(), CURLOPT_FOLLOWLOCATION, 1L);
         curl_easy_setopt(curl.get(), CURLOPT_MAXREDIRS, MAX_REDIRECTS);
-        curl_easy_setopt(curl.get(), CURLOPT_TIMEOUT, DOWNLOAD_TIMEOUT);
-        curl_easy_setopt(curl.get(), CURLOPT_WRITEFUNCTION, DownloadBuffer::write_callback);
-        curl_easy_setopt(curl.get(), CURLOPT_WRITEDATA, &buffer);
+        curl_easy_setopt(curl.get(), CURLOPT_CONNECTTIMEOUT, DOWNLOAD_TIMEOUT);
+        curl_easy_setopt(curl.get(), CURLOPT_LOW_SPEED_LIMIT, STALL_SPEED_LIMIT);
+        curl_easy_setopt(curl.get(), CURLOPT_LOW_SPEED_TIME, STALL_SPEED_TIME);
+        curl_easy_setopt(curl.get(), CURLOPT_WRITEFUNCTION, DownloadSink::write_callback);
+        curl_easy_setopt(curl.get(), CURLOPT_WRITEDATA, &sink);
         curl_easy_setopt(curl.get(), CURLOPT_USERAGENT, "claudev-installer/cpp");
         curl_easy_setopt(curl.get(), CURLOPT_SSL_VERIFYPEER, 1L);
+        // Fail on HTTP >= 400 so error pages never reach the extractor
+        curl_easy_setopt(curl.get(), CURLOPT_FAILONERROR, 1L);
 
         const CURLcode res = curl_easy_perform(curl.get());
+        pipe.close(res != CURLE_OK);
+
+        extractor.join();
 
         if (res != CURLE_OK) {
             std::cerr << "\nDownload failed: " << curl_easy_strerror(res) << std::endl;
-            return std::nullopt;
+            return false;
         }
 
-        long response_code;
-        curl_easy_getinfo(curl.get(), CURLINFO_RESPONSE_CODE, &response_code);
-
-        if (response_code != 200) {
-            std::cerr << "\nHTTP " << response_code << std::endl;
-            return std::nullopt;
+        if (!extract_ok) {
+            return false;
         }
 
         std::cout << " - done" << std::endl;
-        return std::move(buffer.data);
+        return true;
 
     } catch (const std::exception& e) {
         std::cerr << "\nDownload exception: " << e.what() << std::endl;
-        return std::nullopt;
+        return false;
+    }
+}
+
+// Probe the final (post-redirect) URL and Content-Length with a HEAD request.
+// Returns 0 when the size is unknown (segmented download not possible).
+curl_off_t probe_content_length(std::string_view url, std::string& effective_url) {
+    try {
+        CurlHandle curl;
+
+        curl_easy_setopt(curl.get(), CURLOPT_URL, url.data());
+        curl_easy_setopt(curl.get(), CURLOPT_NOBODY, 1L);
+        curl_easy_setopt(curl.get(), CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(curl.get(), CURLOPT_MAXREDIRS, MAX_REDIRECTS);
+        curl_easy_setopt(curl.get(), CURLOPT_CONNECTTIMEOUT, DOWNLOAD_TIMEOUT);
+        curl_easy_setopt(curl.get(), CURLOPT_USERAGENT, "claudev-installer/cpp");
+        curl_easy_setopt(curl.get(), CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(curl.get(), CURLOPT_FAILONERROR, 1L);
+
+        if (curl_easy_perform(curl.get()) != CURLE_OK) {
+            return 0;
+        }
+
+        curl_off_t length = 0;
+        curl_easy_getinfo(curl.get(), CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length);
+
+        // Resolve redirects once here so every segment skips the redirect chain
+        char* final_url = nullptr;
+        curl_easy_getinfo(curl.get(), CURLINFO_EFFECTIVE_URL, &final_url);
+        if (final_url) effective_url = final_url;
+
+        return length > 0 ? length : 0;
+
+    } catch (const std::exception&) {
+        return 0;
     }
 }
 
-// Extract archive using libarchive (handles both tar.gz and zip)
-bool extract_archive(const std::vector<uint8_t>& data, const fs::path& dest_dir) {
+// One in-flight byte range writing directly into the preallocated file
+struct SegmentTransfer {
+    size_t index;
+    curl_off_t begin;
+    curl_off_t end;  // inclusive
+    std::fstream file;
+    CURL* handle = nullptr;
+    std::atomic<size_t>* total_bytes = nullptr;
+
+    static size_t write_callback(void* contents, size_t size, size_t nmemb, void* userp) {
+        size_t total_size = size * nmemb;
+        auto* seg = static_cast<SegmentTransfer*>(userp);
+        seg->file.write(static_cast<const char*>(contents), total_size);
+        if (!seg->file) return 0;
+        seg->total_bytes->fetch_add(total_size, std::memory_order_relaxed);
+        return total_size;
+    }
+};
+
+// Resume journal: records which segments are already on disk so an
+// interrupted install continues instead of re-downloading. Plain text,
+// one completed segment index per line after a header binding it to the
+// file size and segment size it was written for.
+class ResumeJournal {
+    fs::path path_;
+    std::ofstream out_;
+
+public:
+    explicit ResumeJournal(fs::path path) : path_(std::move(path)) {}
+
+    std::vector<bool> load(curl_off_t total_size, size_t segment_count) {
+        std::vector<bool> done(segment_count, false);
+
+        std::ifstream in(path_);
+        if (in.is_open()) {
+            std::string header;
+            std::getline(in, header);
+            if (header == journal_header(total_size)) {
+                size_t index;
+                while (in >> index) {
+                    if (index < segment_count) done[index] = true;
+                }
+            } else {
+                done.assign(segment_count, false); // stale journal for a different release
+            }
+        }
+
+        // Reopen for appending, rewriting the header if the journal was stale/missing
+        bool valid = std::count(done.begin(), done.end(), true) > 0;
+        out_.open(path_, valid ? std::ios::app : std::ios::trunc);
+        if (!valid) {
+            out_ << journal_header(total_size) << "\n";
+        }
+        out_.flush();
+
+        return done;
+    }
+
+    void mark_done(size_t index) {
+        out_ << index << "\n";
+        out_.flush(); // survive an interrupted install
+    }
+
+    // Discard every recorded segment: truncate the journal and rewrite the
+    // header. Needed when the partial file itself is discarded after load(),
+    // otherwise stale indices would mark zero-filled segments as downloaded
+    // on the next resume.
+    void reset(curl_off_t total_size) {
+        out_.close();
+        out_.open(path_, std::ios::trunc);
+        out_ << journal_header(total_size) << "\n";
+        out_.flush();
+    }
+
+    void remove() {
+        out_.close();
+        std::error_code ec;
+        fs::remove(path_, ec);
+    }
+
+private:
+    static std::string journal_header(curl_off_t total_size) {
+        return "claudev-resume v1 " + std::to_string(total_size) + " " + std::to_string(SEGMENT_SIZE);
+    }
+};
+
+// Segmented downloader: fetch N byte ranges concurrently over a curl multi
+// handle into a preallocated file, journaling completed segments for resume.
+bool download_segmented(const std::string& url, const fs::path& dest_file, curl_off_t total_size) {
+    const size_t segment_count = static_cast<size_t>((total_size + SEGMENT_SIZE - 1) / static_cast<curl_off_t>(SEGMENT_SIZE));
+
+    ResumeJournal journal(dest_file.string() + ".journal");
+    std::vector<bool> done = journal.load(total_size, segment_count);
+
+    // Preallocate (or reuse) the destination so segments can write at their offsets
+    std::error_code ec;
+    if (!fs::exists(dest_file) || fs::file_size(dest_file, ec) != static_cast<uintmax_t>(total_size)) {
+        std::ofstream create(dest_file, std::ios::binary);
+        if (!create) {
+            std::cerr << "Failed to create " << dest_file << std::endl;
+            return false;
+        }
+        create.close();
+        fs::resize_file(dest_file, static_cast<uintmax_t>(total_size), ec);
+        if (ec) {
+            std::cerr << "Failed to preallocate: " << ec.message() << std::endl;
+            return false;
+        }
+        done.assign(segment_count, false); // fresh file invalidates any journal state
+        journal.reset(total_size);
+    }
+
+    size_t resumed = static_cast<size_t>(std::count(done.begin(), done.end(), true));
+    if (resumed > 0) {
+        std::cout << "  Resuming: " << resumed << "/" << segment_count << " segments already downloaded" << std::endl;
+    }
+
+    CURLM* multi = curl_multi_init();
+    if (!multi) {
+        std::cerr << "Failed to initialize CURL multi handle" << std::endl;
+        return false;
+    }
+
+    std::atomic<size_t> total_bytes{resumed * SEGMENT_SIZE};
+    std::vector<std::unique_ptr<SegmentTransfer>> active;
+    std::vector<int> retries(segment_count, 0);
+    size_t next_segment = 0;
+    size_t last_reported_mb = 0;
+    bool failed = false;
+
+    auto start_segment = [&](size_t index) -> bool {
+        auto seg = std::make_unique<SegmentTransfer>();
+        seg->index = index;
+        seg->begin = static_cast<curl_off_t>(index) * static_cast<curl_off_t>(SEGMENT_SIZE);
+        seg->end = std::min<curl_off_t>(seg->begin + SEGMENT_SIZE - 1, total_size - 1);
+        seg->total_bytes = &total_bytes;
+
+        seg->file.open(dest_file, std::ios::in | std::ios::out | std::ios::binary);
+        if (!seg->file) return false;
+        seg->file.seekp(seg->begin);
+
+        seg->handle = curl_easy_init();
+        if (!seg->handle) return false;
+
+        const std::string range = std::to_string(seg->begin) + "-" + std::to_string(seg->end);
+        curl_easy_setopt(seg->handle, CURLOPT_URL, url.c_str());
+        curl_easy_setopt(seg->handle, CURLOPT_RANGE, range.c_str());
+        curl_easy_setopt(seg->handle, CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(seg->handle, CURLOPT_MAXREDIRS, MAX_REDIRECTS);
+        curl_easy_setopt(seg->handle, CURLOPT_CONNECTTIMEOUT, DOWNLOAD_TIMEOUT);
+        curl_easy_setopt(seg->handle, CURLOPT_LOW_SPEED_LIMIT, STALL_SPEED_LIMIT);
+        curl_easy_setopt(seg->handle, CURLOPT_LOW_SPEED_TIME, STALL_SPEED_TIME);
+        curl_easy_setopt(seg->handle, CURLOPT_WRITEFUNCTION, SegmentTransfer::write_callback);
+        curl_easy_setopt(seg->handle, CURLOPT_WRITEDATA, seg.get());
+        curl_easy_setopt(seg->handle, CURLOPT_USERAGENT, "claudev-installer/cpp");
+        curl_easy_setopt(seg->handle, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(seg->handle, CURLOPT_FAILONERROR, 1L);
+        curl_easy_setopt(seg->handle, CURLOPT_PRIVATE, seg.get());
+
+        curl_multi_add_handle(multi, seg->handle);
+        active.push_back(std::move(seg));
+        return true;
+    };
+
+    auto fill_slots = [&]() {
+        while (active.size() < MAX_CONNECTIONS && next_segment < segment_count && !failed) {
+            size_t index = next_segment++;
+            if (done[index]) continue;
+            if (!start_segment(index)) {
+                failed = true;
+            }
+        }
+    };
+
+    fill_slots();
+
+    int still_running = 0;
+    do {
+        CURLMcode mc = curl_multi_perform(multi, &still_running);
+        if (mc == CURLM_OK && still_running > 0) {
+            mc = curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+        }
+        if (mc != CURLM_OK) {
+            std::cerr << "\nDownload failed: " << curl_multi_strerror(mc) << std::endl;
+            failed = true;
+            break;
+        }
+
+        // Reap completed transfers
+        int msgs_left = 0;
+        CURLMsg* msg;
+        while ((msg = curl_multi_info_read(multi, &msgs_left)) != nullptr) {
+            if (msg->msg != CURLMSG_DONE) continue;
+
+            SegmentTransfer* seg = nullptr;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &seg);
+            const CURLcode result = msg->data.result;
+
+            long response_code = 0;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &response_code);
+
+            curl_multi_remove_handle(multi, msg->easy_handle);
+            curl_easy_cleanup(msg->easy_handle);
+
+            const size_t index = seg->index;
+            seg->file.flush();
+            const bool seg_ok = (result == CURLE_OK) && (response_code == 206) && seg->file.good();
+            seg->handle = nullptr;
+            active.erase(std::remove_if(active.begin(), active.end(),
+                                        [seg](const auto& p) { return p.get() == seg; }),
+                         active.end());
+
+            if (seg_ok) {
+                done[index] = true;
+                journal.mark_done(index);
+            } else if (response_code == 200) {
+                // Server ignored the Range header: segmented download is not
+                // possible against this host, bail out to the streaming path
+                failed = true;
+            } else if (++retries[index] <= 2) {
+                if (!start_segment(index)) failed = true;
+            } else {
+                std::cerr << "\nSegment " << index << " failed: "
+                          << curl_easy_strerror(result) << " (HTTP " << response_code << ")" << std::endl;
+                failed = true;
+            }
+        }
+
+        fill_slots();
+
+        // Progress indicator (print every MB)
+        size_t current_mb = total_bytes.load(std::memory_order_relaxed) / (1024 * 1024);
+        if (current_mb > last_reported_mb) {
+            std::cout << "\r  Downloaded " << current_mb << " MB" << std::flush;
+            last_reported_mb = current_mb;
+        }
+    } while (!failed && (still_running > 0 || !active.empty() ||
+                         std::count(done.begin(), done.end(), true) < static_cast<long>(segment_count)));
+
+    // Tear down anything still in flight (journal keeps completed segments)
+    for (auto& seg : active) {
+        if (seg->handle) {
+            curl_multi_remove_handle(multi, seg->handle);
+            curl_easy_cleanup(seg->handle);
+        }
+    }
+    curl_multi_cleanup(multi);
+
+    if (failed) {
+        return false;
+    }
+
+    std::cout << " - done" << std::endl;
+    journal.remove();
+    return true;
+}
+
+// Extract a fully downloaded archive file (segmented path) to dest_dir
+bool extract_archive_file(const fs::path& archive_path, const fs::path& dest_dir) {
     struct archive* a = archive_read_new();
     struct archive* ext = archive_write_disk_new();
 
     if (!a || !ext) {
         std::cerr << "Failed to create archive handles" << std::endl;
+        if (a) archive_read_free(a);
+        if (ext) archive_write_free(ext);
         return false;
     }
 
-    // Enable all formats and filters
     archive_read_support_format_all(a);
     archive_read_support_filter_all(a);
 
-    // Set extraction flags
     int flags = ARCHIVE_EXTRACT_TIME | ARCHIVE_EXTRACT_PERM | ARCHIVE_EXTRACT_ACL | ARCHIVE_EXTRACT_FFLAGS;
     archive_write_disk_set_options(ext, flags);
     archive_write_disk_set_standard_lookup(ext);
 
-    // Open archive from memory
-    int r = archive_read_open_memory(a, data.data(), data.size());
-    if (r != ARCHIVE_OK) {
+    bool success = false;
+    if (archive_read_open_filename(a, archive_path.c_str(), STREAM_READ_SIZE) != ARCHIVE_OK) {
         std::cerr << "Failed to open archive: " << archive_error_string(a) << std::endl;
-        archive_read_free(a);
-        archive_write_free(ext);
-        return false;
+    } else {
+        success = extract_entries(a, ext, dest_dir);
     }
 
-    // Extract all entries
-    struct archive_entry* entry;
-    bool success = true;
+    archive_read_close(a);
+    archive_read_free(a);
+    archive_write_close(ext);
+    archive_write_free(ext);
 
-    while (archive_read_next_header(a, &entry) == ARCHIVE_OK) {
-        // Construct full path
-        const char* current_file = archive_entry_pathname(entry);
-        fs::path full_path = dest_dir / current_file;
+    return success;
+}
 
-        archive_entry_set_pathname(entry, full_path.c_str());
+// Install entry point: prefer the segmented downloader (resumable, saturates
+// high-latency links), fall back to the single-connection streaming pipeline
+// when the size is unknown or the server rejects ranged requests.
+bool fetch_and_install(const std::string& url, const fs::path& bin_dir, std::string_view archive_ext) {
+    std::string effective_url = url;
+    const curl_off_t total_size = probe_content_length(url, effective_url);
+
+    if (total_size > static_cast<curl_off_t>(SEGMENT_SIZE)) {
+        const fs::path partial = bin_dir / (std::string(BINARY_NAME) + "." + std::string(archive_ext) + ".partial");
+
+        if (download_segmented(effective_url, partial, total_size)) {
+            const bool ok = extract_archive_file(partial, bin_dir);
+            std::error_code ec;
+            fs::remove(partial, ec);
+            return ok;
+        }
 
-        r = archive_write_header(ext, entry);
-        if (r != ARCHIVE_OK) {
-            std::cerr << "Write header failed: " << archive_error_string(ext) << std::endl;
-            success = false;
-            break;
+        std::cout << "  Falling back to single-connection download" << std::endl;
+    }
+
+    return download_and_extract(url, bin_dir);
+}
+
+// Minimal SHA-256 (FIPS 180-4) for content-addressing cached binaries.
+// Embedded so the installer keeps its curl/z/archive-only link line.
+class Sha256 {
+    uint32_t state_[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                          0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    uint8_t block_[64];
+    size_t block_len_ = 0;
+    uint64_t total_len_ = 0;
+
+    static constexpr uint32_t K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+    static uint32_t rotr(uint32_t x, uint32_t n) { return (x >> n) | (x << (32 - n)); }
+
+    void process_block(const uint8_t* p) {
+        uint32_t w[64];
+        for (int i = 0; i < 16; i++) {
+            w[i] = (uint32_t(p[i * 4]) << 24) | (uint32_t(p[i * 4 + 1]) << 16) |
+                   (uint32_t(p[i * 4 + 2]) << 8) | uint32_t(p[i * 4 + 3]);
+        }
+        for (int i = 16; i < 64; i++) {
+            uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
         }
 
-        // Copy data
-        const void* buff;
-        size_t size;
-        int64_t offset;
+        uint32_t a = state_[0], b = state_[1], c = state_[2], d = state_[3];
+        uint32_t e = state_[4], f = state_[5], g = state_[6], h = state_[7];
+
+        for (int i = 0; i < 64; i++) {
+            uint32_t s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+            uint32_t ch = (e & f) ^ (~e & g);
+            uint32_t t1 = h + s1 + ch + K[i] + w[i];
+            uint32_t s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+            uint32_t maj = (a & b) ^ (a & c) ^ (b & c);
+            uint32_t t2 = s0 + maj;
+            h = g; g = f; f = e; e = d + t1;
+            d = c; c = b; b = a; a = t1 + t2;
+        }
 
-        while ((r = archive_read_data_block(a, &buff, &size, &offset)) == ARCHIVE_OK) {
-            if (archive_write_data_block(ext, buff, size, offset) != ARCHIVE_OK) {
-                std::cerr << "Write data failed: " << archive_error_string(ext) << std::endl;
-                success = false;
-                break;
+        state_[0] += a; state_[1] += b; state_[2] += c; state_[3] += d;
+        state_[4] += e; state_[5] += f; state_[6] += g; state_[7] += h;
+    }
+
+public:
+    void update(const void* data, size_t len) {
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        total_len_ += len;
+        while (len > 0) {
+            size_t chunk = std::min(len, sizeof(block_) - block_len_);
+            std::memcpy(block_ + block_len_, bytes, chunk);
+            block_len_ += chunk;
+            bytes += chunk;
+            len -= chunk;
+            if (block_len_ == sizeof(block_)) {
+                process_block(block_);
+                block_len_ = 0;
             }
         }
+    }
 
-        if (r != ARCHIVE_EOF) {
-            std::cerr << "Read data failed: " << archive_error_string(a) << std::endl;
-            success = false;
-            break;
+    std::string hex_digest() {
+        // Pad: 0x80, zeros, then the bit length big-endian
+        uint64_t bit_len = total_len_ * 8;
+        uint8_t pad = 0x80;
+        update(&pad, 1);
+        uint8_t zero = 0;
+        while (block_len_ != 56) update(&zero, 1);
+        for (int i = 7; i >= 0; i--) {
+            uint8_t b = static_cast<uint8_t>(bit_len >> (i * 8));
+            std::memcpy(block_ + block_len_++, &b, 1);
+        }
+        process_block(block_);
+        block_len_ = 0;
+
+        static const char* hex = "0123456789abcdef";
+        std::string out;
+        out.reserve(64);
+        for (uint32_t s : state_) {
+            for (int i = 28; i >= 0; i -= 4) {
+                out.push_back(hex[(s >> i) & 0xF]);
+            }
         }
+        return out;
+    }
+};
 
-        r = archive_write_finish_entry(ext);
-        if (r != ARCHIVE_OK) {
-            std::cerr << "Finish entry failed: " << archive_error_string(ext) << std::endl;
-            success = false;
-            break;
+constexpr uint32_t Sha256::K[64];
+
+// Hex SHA-256 of a file, or nullopt if unreadable
+std::optional<std::string> sha256_file(const fs::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return std::nullopt;
+
+    Sha256 hasher;
+    std::vector<char> buffer(STREAM_READ_SIZE);
+    while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0) {
+        hasher.update(buffer.data(), static_cast<size_t>(file.gcount()));
+    }
+    return hasher.hex_digest();
+}
+
+// Machine-global cache root shared by every project that installs claudev.
+// Override with CLAUDEV_CACHE_DIR (useful for CI cache mounts).
+fs::path global_cache_root() {
+    if (const char* override_dir = std::getenv("CLAUDEV_CACHE_DIR")) {
+        return fs::path(override_dir);
+    }
+
+    const char* home = std::getenv("HOME");
+#ifdef _WIN32
+    if (const char* local = std::getenv("LOCALAPPDATA")) {
+        return fs::path(local) / "claudev" / "cache";
+    }
+#elif __APPLE__
+    if (home) return fs::path(home) / "Library" / "Caches" / "claudev";
+#else
+    if (const char* xdg = std::getenv("XDG_CACHE_HOME")) {
+        return fs::path(xdg) / "claudev";
+    }
+    if (home) return fs::path(home) / ".cache" / "claudev";
+#endif
+    return fs::temp_directory_path() / "claudev-cache";
+}
+
+// Cache entry directory for one (version, target_triple) pair; the binary
+// inside is addressed by its sha256, recorded in a sidecar file.
+fs::path cache_entry_dir(std::string_view version, std::string_view target_triple) {
+    return global_cache_root() / "bin" / (std::string("v") + std::string(version) + "-" + std::string(target_triple));
+}
+
+// Fetch the published digest manifest for this release (hex sha256 of the
+// extracted binary). Missing manifest is not an error: older releases
+// predate manifest publishing, so verification is best-effort.
+std::optional<std::string> fetch_manifest_digest(const std::string& archive_url) {
+    try {
+        CurlHandle curl;
+        std::string body;
+
+        auto write_string = +[](void* contents, size_t size, size_t nmemb, void* userp) -> size_t {
+            static_cast<std::string*>(userp)->append(static_cast<const char*>(contents), size * nmemb);
+            return size * nmemb;
+        };
+
+        const std::string manifest_url = archive_url + ".sha256";
+        curl_easy_setopt(curl.get(), CURLOPT_URL, manifest_url.c_str());
+        curl_easy_setopt(curl.get(), CURLOPT_FOLLOWLOCATION, 1L);
+        curl_easy_setopt(curl.get(), CURLOPT_MAXREDIRS, MAX_REDIRECTS);
+        curl_easy_setopt(curl.get(), CURLOPT_CONNECTTIMEOUT, DOWNLOAD_TIMEOUT);
+        curl_easy_setopt(curl.get(), CURLOPT_WRITEFUNCTION, write_string);
+        curl_easy_setopt(curl.get(), CURLOPT_WRITEDATA, &body);
+        curl_easy_setopt(curl.get(), CURLOPT_USERAGENT, "claudev-installer/cpp");
+        curl_easy_setopt(curl.get(), CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(curl.get(), CURLOPT_FAILONERROR, 1L);
+
+        if (curl_easy_perform(curl.get()) != CURLE_OK) {
+            return std::nullopt;
         }
+
+        // Accept both bare digests and "digest  filename" (sha256sum output)
+        const size_t end = body.find_first_of(" \t\r\n");
+        std::string digest = (end == std::string::npos) ? body : body.substr(0, end);
+        if (digest.size() != 64) return std::nullopt;
+        return digest;
+
+    } catch (const std::exception&) {
+        return std::nullopt;
     }
+}
 
-    archive_read_close(a);
-    archive_read_free(a);
-    archive_write_close(ext);
-    archive_write_free(ext);
+// Warm path: hardlink (or copy) the cached binary into bin_dir after
+// re-verifying its digest against the sidecar. Zero network I/O.
+bool try_install_from_cache(const fs::path& entry_dir, const fs::path& binary_path) {
+    const fs::path cached_binary = entry_dir / binary_path.filename();
+    const fs::path sidecar = entry_dir / (binary_path.filename().string() + ".sha256");
 
-    return success;
+    if (!fs::exists(cached_binary) || !fs::exists(sidecar)) {
+        return false;
+    }
+
+    std::string expected;
+    std::ifstream sidecar_file(sidecar);
+    if (!(sidecar_file >> expected) || expected.size() != 64) {
+        return false;
+    }
+
+    const auto actual = sha256_file(cached_binary);
+    if (!actual || *actual != expected) {
+        // Corrupt cache entry: drop it so the cold path repopulates
+        std::error_code ec;
+        fs::remove(cached_binary, ec);
+        fs::remove(sidecar, ec);
+        return false;
+    }
+
+    std::error_code ec;
+    fs::create_hard_link(cached_binary, binary_path, ec);
+    if (ec) {
+        // Different filesystem (or FS without hardlinks): fall back to a copy
+        fs::copy_file(cached_binary, binary_path, fs::copy_options::overwrite_existing, ec);
+        if (ec) return false;
+    }
+    return true;
+}
+
+// Cold path follow-up: store the freshly installed binary in the global
+// cache so sibling projects skip the download entirely.
+void populate_cache(const fs::path& entry_dir, const fs::path& binary_path, const std::string& digest) {
+    std::error_code ec;
+    fs::create_directories(entry_dir, ec);
+    if (ec) return;
+
+    const fs::path cached_binary = entry_dir / binary_path.filename();
+    const fs::path sidecar = entry_dir / (binary_path.filename().string() + ".sha256");
+
+    // Stage under a temp name so concurrent installs never see a partial entry
+    const fs::path staging = cached_binary.string() + ".tmp" + std::to_string(
+#ifdef _WIN32
+        GetCurrentProcessId()
+#else
+        getpid()
+#endif
+    );
+
+    fs::copy_file(binary_path, staging, fs::copy_options::overwrite_existing, ec);
+    if (ec) return;
+    fs::rename(staging, cached_binary, ec);
+    if (ec) {
+        fs::remove(staging, ec);
+        return;
+    }
+
+    std::ofstream(sidecar) << digest << "\n";
 }
 
 // Set executable permissions (Unix only)
@@ -316,8 +1034,24 @@ int main() {
         return 0;
     }
 
-    // Build download URL
     const std::string version = get_package_version();
+
+    // Consult the machine-global cache before touching the network
+    const fs::path cache_dir = cache_entry_dir(version, platform.target_triple);
+    {
+        std::error_code ec;
+        fs::create_directories(bin_dir, ec);
+        if (!ec && try_install_from_cache(cache_dir, binary_path)) {
+            if (platform.os != "win32") {
+                make_executable(binary_path);
+            }
+            std::cout << "claudev: Installed from cache (" << cache_dir.string() << ")" << std::endl;
+            curl_global_cleanup();
+            return 0;
+        }
+    }
+
+    // Build download URL
     const std::string url = std::string("https://github.com/") +
                            std::string(REPO) +
                            "/releases/download/v" + version +
@@ -327,16 +1061,7 @@ int main() {
 
     std::cout << "claudev: Downloading for " << platform.os << "-" << platform.arch << std::endl;
 
-    // Download archive
-    auto download_result = download_file(url);
-    if (!download_result) {
-        std::cerr << "claudev: Download failed" << std::endl;
-        std::cerr << "claudev: Install manually: cargo install claudev" << std::endl;
-        curl_global_cleanup();
-        return 0; // Don't fail npm install
-    }
-
-    // Create bin directory
+    // Create bin directory up front: extraction starts while the download is in flight
     std::error_code ec;
     fs::create_directories(bin_dir, ec);
     if (ec) {
@@ -345,11 +1070,12 @@ int main() {
         return 1;
     }
 
-    // Extract archive
-    if (!extract_archive(*download_result, bin_dir)) {
-        std::cerr << "claudev: Extraction failed" << std::endl;
+    // Segmented resumable download when possible, streaming pipeline otherwise
+    if (!fetch_and_install(url, bin_dir, platform.archive_ext)) {
+        std::cerr << "claudev: Install failed" << std::endl;
+        std::cerr << "claudev: Install manually: cargo install claudev" << std::endl;
         curl_global_cleanup();
-        return 1;
+        return 0; // Don't fail npm install
     }
 
     // Make executable (Unix)
@@ -359,6 +1085,21 @@ int main() {
         }
     }
 
+    // Verify against the published manifest when one exists, then seed the
+    // global cache so sibling projects install without network I/O
+    if (const auto digest = sha256_file(binary_path)) {
+        if (const auto published = fetch_manifest_digest(url)) {
+            if (*digest != *published) {
+                std::cerr << "claudev: Checksum mismatch, removing binary" << std::endl;
+                std::error_code ec;
+                fs::remove(binary_path, ec);
+                curl_global_cleanup();
+                return 1;
+            }
+        }
+        populate_cache(cache_dir, binary_path, *digest);
+    }
+
     std::cout << "claudev: Installed successfully!" << std::endl;
 
     curl_global_cleanup();
@@ -7,7 +7,7 @@ use std::path::PathBuf;
 use tracing::info;
 use walkdir::WalkDir;
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct AdvancedAnalytics {
     pub language_stats: LanguageStats,
     pub project_allocation: ProjectAllocation,
@@ -22,7 +22,7 @@ pub struct AdvancedAnalytics {
     pub code_quality: CodeQuality,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct LanguageStats {
     pub by_language: HashMap<String, LanguageMetrics>,
     pub by_framework: HashMap<String, usize>,
@@ -31,7 +31,7 @@ pub struct LanguageStats {
     pub polyglot_score: f64, // How many languages you use
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct LanguageMetrics {
     pub mentions: usize,
     pub hours_estimated: f64,
@@ -41,14 +41,14 @@ pub struct LanguageMetrics {
     pub proficiency_trend: String, // "learning", "intermediate", "expert"
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct TechAdoption {
     pub technology: String,
     pub adopted_date: String,
     pub category: String, // "language", "framework", "tool"
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ProjectAllocation {
     pub by_project: HashMap<String, ProjectMetrics>,
     pub total_projects: usize,
@@ -58,7 +58,7 @@ pub struct ProjectAllocation {
     pub average_focus_duration: f64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ProjectMetrics {
     pub hours: f64,
     pub sessions: usize,
@@ -69,7 +69,7 @@ pub struct ProjectMetrics {
     pub last_seen: String,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct TaskCompletion {
     pub total_tasks: usize,
     pub completed_tasks: usize,
@@ -80,14 +80,14 @@ pub struct TaskCompletion {
     pub retry_patterns: RetryPatterns,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct TaskTypeStats {
     pub count: usize,
     pub completion_rate: f64,
     pub average_attempts: f64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct RetryPatterns {
     pub total_retries: usize,
     pub tasks_needing_retries: usize,
@@ -95,7 +95,7 @@ pub struct RetryPatterns {
     pub most_retried_task_types: Vec<(String, usize)>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ErrorPatterns {
     pub total_errors: usize,
     pub by_category: HashMap<String, usize>,
@@ -105,14 +105,14 @@ pub struct ErrorPatterns {
     pub mtbf: f64, // Mean time between failures (hours)
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ErrorInstance {
     pub error_type: String,
     pub count: usize,
     pub example: String,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct SentimentAnalysis {
     pub overall_sentiment: f64, // -1.0 to 1.0
     pub sentiment_timeline: Vec<SentimentPoint>,
@@ -122,14 +122,14 @@ pub struct SentimentAnalysis {
     pub mood_by_weekday: HashMap<String, f64>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct SentimentPoint {
     pub timestamp: String,
     pub sentiment: f64,
     pub context: String,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct FrustrationPeak {
     pub timestamp: String,
     pub intensity: f64,
@@ -137,14 +137,14 @@ pub struct FrustrationPeak {
     pub resolution_time: Option<f64>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct TopicClusters {
     pub clusters: Vec<TopicCluster>,
     pub word_frequencies: Vec<(String, usize)>,
     pub trending_topics: Vec<TrendingTopic>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct TopicCluster {
     pub name: String,
     pub keywords: Vec<String>,
@@ -152,14 +152,14 @@ pub struct TopicCluster {
     pub hours_spent: f64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct TrendingTopic {
     pub topic: String,
     pub week: String,
     pub mentions: usize,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ActivityHeatmap {
     pub daily_activity: HashMap<String, f64>, // "YYYY-MM-DD" -> hours
     pub contribution_calendar: Vec<CalendarDay>,
@@ -168,14 +168,14 @@ pub struct ActivityHeatmap {
     pub total_active_days: usize,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct CalendarDay {
     pub date: String,
     pub hours: f64,
     pub intensity: usize, // 0-4 for visualization
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct LearningCurve {
     pub by_technology: HashMap<String, LearningProgress>,
     pub learning_velocity: f64, // Technologies learned per month
@@ -183,7 +183,7 @@ pub struct LearningCurve {
     pub knowledge_gaps: Vec<KnowledgeGap>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct LearningProgress {
     pub technology: String,
     pub first_exposure: String,
@@ -193,14 +193,14 @@ pub struct LearningProgress {
     pub error_rate_trend: Vec<f64>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct KnowledgeGap {
     pub topic: String,
     pub question_count: usize,
     pub last_asked: String,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct FlowState {
     pub flow_sessions: usize,
     pub total_flow_hours: f64,
@@ -212,7 +212,7 @@ pub struct FlowState {
     pub interruption_cost: f64, // Hours lost
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct PromptEvolution {
     pub average_prompt_length_over_time: Vec<(String, f64)>,
     pub specificity_score: f64,
@@ -220,14 +220,14 @@ pub struct PromptEvolution {
     pub prompt_patterns: Vec<PromptPattern>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct PromptPattern {
     pub pattern: String,
     pub usage_count: usize,
     pub success_rate: f64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct CodeQuality {
     pub ai_review_insights: usize,
     pub bugs_caught_by_ai: usize,
@@ -235,7 +235,7 @@ pub struct CodeQuality {
     pub code_quality_trend: Vec<QualityPoint>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct QualityPoint {
     pub date: String,
     pub quality_score: f64,
@@ -3,11 +3,10 @@ use crate::parsers::claude::ClaudeParser;
 use crate::parsers::cline::ClineParser;
 use crate::parsers::cursor::CursorParser;
 use crate::parsers::generic::GenericParser;
-use crate::parsers::{EntryCategory, LogParser};
+use crate::parsers::LogParser;
 use anyhow::Result;
-use chrono::Timelike;
 use std::collections::HashMap;
-use tracing::{debug, info};
+use tracing::{debug, info, info_span};
 
 pub struct Analyzer {
     tool_filter: Option<String>,
@@ -45,7 +44,10 @@ impl Analyzer {
         // Discover logs
         let base_dir = dirs::home_dir().expect("Could not determine home directory");
         let discovery = crate::discovery::LogDiscovery::new(base_dir, true);
-        let findings = discovery.scan()?;
+        let findings = {
+            let _span = info_span!("discovery_scan").entered();
+            discovery.scan_cached()?
+        };
 
         // Analyze each tool
         let mut tools = HashMap::new();
@@ -104,6 +106,13 @@ impl Analyzer {
     }
 
     async fn analyze_tool(&self, location: &LogLocation) -> Result<ToolAnalysis> {
+        let _span = info_span!(
+            "parse_location",
+            path = %location.path.display(),
+            bytes = location.size_bytes
+        )
+        .entered();
+
         // Select appropriate parser based on tool
         let parsers: Vec<Box<dyn LogParser>> = vec![
             Box::new(ClaudeParser),
@@ -124,21 +133,14 @@ impl Analyzer {
                 debug!("Using parser for: {}", location.path.display());
                 match parser.parse(&location.path) {
                     Ok(parsed) => {
-                        // Extract metrics from parsed log
+                        // Metadata aggregates cover the whole file even when
+                        // a streaming parser retains only a bounded sample of
+                        // entries (see GenericParser).
                         session_count = parsed.metadata.entry_count.max(1);
-
-                        for entry in &parsed.entries {
-                            match entry.category {
-                                EntryCategory::UserPrompt => user_prompts += 1,
-                                EntryCategory::AssistantResponse => assistant_responses += 1,
-                                _ => {}
-                            }
-
-                            // Build hourly distribution
-                            if let Some(ts) = entry.timestamp {
-                                let hour = ts.hour() as u8;
-                                *hourly_distribution.entry(hour).or_insert(0) += 1;
-                            }
+                        user_prompts += parsed.metadata.user_prompts;
+                        assistant_responses += parsed.metadata.assistant_responses;
+                        for (hour, count) in &parsed.metadata.hourly_distribution {
+                            *hourly_distribution.entry(*hour).or_insert(0) += count;
                         }
 
                         prompt_count = user_prompts;
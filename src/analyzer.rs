@@ -1,12 +1,12 @@
 #![allow(dead_code)]
 
+use crate::conversation_store::{self, ClineTask, ConversationStore};
 use anyhow::Result;
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
-use std::fs;
 use std::path::PathBuf;
+use std::sync::Arc;
 use tracing::info;
-use walkdir::WalkDir;
 
 #[derive(Debug, Serialize)]
 pub struct ConversationStats {
@@ -43,12 +43,19 @@ struct ModelUsage {
 }
 
 pub struct ConversationAnalyzer {
-    base_dir: PathBuf,
+    store: Arc<ConversationStore>,
 }
 
 impl ConversationAnalyzer {
     pub fn new(base_dir: PathBuf) -> Self {
-        Self { base_dir }
+        Self {
+            store: ConversationStore::build(&base_dir),
+        }
+    }
+
+    /// Reuses an already-built store instead of re-reading the corpus
+    pub fn with_store(store: Arc<ConversationStore>) -> Self {
+        Self { store }
     }
 
     pub fn analyze(&self) -> Result<ConversationStats> {
@@ -71,46 +78,8 @@ impl ConversationAnalyzer {
     }
 
     fn analyze_cline_tasks(&self, stats: &mut ConversationStats) -> Result<()> {
-        let patterns = vec![
-            ".config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks",
-            ".config/Code/User/globalStorage/kilocode.kilo-code/tasks",
-            ".config/Code/User/globalStorage/rooveterinaryinc.roo-cline/tasks",
-            ".var/app/com.visualstudio.code/config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks",
-            ".var/app/com.visualstudio.code/config/Code/User/globalStorage/kilocode.kilo-code/tasks",
-        ];
-
-        for pattern in patterns {
-            let path = self.base_dir.join(pattern);
-            if !path.exists() {
-                continue;
-            }
-
-            let tool_name = if pattern.contains("claude-dev") {
-                "Cline"
-            } else if pattern.contains("kilo-code") {
-                "Kilo"
-            } else {
-                "Roo-Cline"
-            };
-
-            for entry in WalkDir::new(&path).min_depth(1).max_depth(1) {
-                let entry = entry?;
-                if !entry.file_type().is_dir() {
-                    continue;
-                }
-
-                let api_history = entry.path().join("api_conversation_history.json");
-                let metadata_file = entry.path().join("task_metadata.json");
-
-                if api_history.exists() {
-                    self.process_cline_conversation(
-                        &api_history,
-                        &metadata_file,
-                        tool_name,
-                        stats,
-                    )?;
-                }
-            }
+        for task in &self.store.cline_tasks {
+            self.process_cline_conversation(task, stats)?;
         }
 
         Ok(())
@@ -118,13 +87,14 @@ impl ConversationAnalyzer {
 
     fn process_cline_conversation(
         &self,
-        api_history: &PathBuf,
-        metadata_file: &PathBuf,
-        tool_name: &str,
+        task: &ClineTask,
         stats: &mut ConversationStats,
     ) -> Result<()> {
-        let content = fs::read_to_string(api_history)?;
-        let messages: Vec<ClineMessage> = serde_json::from_str(&content)?;
+        let messages: Vec<ClineMessage> = task
+            .messages
+            .iter()
+            .filter_map(conversation_store::view)
+            .collect();
 
         let mut user_count = 0;
         let mut assistant_count = 0;
@@ -138,13 +108,13 @@ impl ConversationAnalyzer {
         }
 
         let mut tokens = 0u64;
-        if metadata_file.exists() {
-            if let Ok(meta_content) = fs::read_to_string(metadata_file) {
-                if let Ok(metadata) = serde_json::from_str::<ClineMetadata>(&meta_content) {
-                    if let Some(usage) = metadata.model_usage {
-                        tokens = usage.input_tokens.unwrap_or(0) + usage.output_tokens.unwrap_or(0);
-                    }
-                }
+        if let Some(metadata) = task
+            .metadata
+            .as_ref()
+            .and_then(conversation_store::view::<ClineMetadata>)
+        {
+            if let Some(usage) = metadata.model_usage {
+                tokens = usage.input_tokens.unwrap_or(0) + usage.output_tokens.unwrap_or(0);
             }
         }
 
@@ -160,7 +130,7 @@ impl ConversationAnalyzer {
 
         let tool_stats = stats
             .by_tool
-            .entry(tool_name.to_string())
+            .entry(task.base_tool().to_string())
             .or_insert(ToolStats {
                 conversations: 0,
                 messages: 0,
@@ -179,16 +149,12 @@ impl ConversationAnalyzer {
     }
 
     fn analyze_claude_history(&self, stats: &mut ConversationStats) -> Result<()> {
-        let history_path = self.base_dir.join(".claude/history.jsonl");
-        if !history_path.exists() {
+        if self.store.claude_history.is_empty() {
             return Ok(());
         }
 
-        let content = fs::read_to_string(&history_path)?;
-        let lines: Vec<&str> = content.lines().collect();
-
         // Claude Code history is event-based, estimate conversations
-        let conversations_est = lines.len() / 10; // rough estimate
+        let conversations_est = self.store.claude_history.len() / 10; // rough estimate
 
         stats.total_conversations += conversations_est;
 
@@ -6,10 +6,176 @@ use colored::*;
 use flate2::write::GzEncoder;
 use flate2::Compression;
 use indicatif::{ProgressBar, ProgressStyle};
+use std::collections::BTreeMap;
 use std::fs::{self, File};
+use std::io::{self, Write};
 use std::path::PathBuf;
+use std::sync::mpsc;
+use std::thread::{self, JoinHandle};
 use walkdir::WalkDir;
 
+/// Input block size for parallel compression. Each block becomes its own
+/// gzip member, so the archive is a standard multi-member gzip stream
+/// (what pigz and `cat a.gz b.gz` produce) readable by MultiGzDecoder.
+const GZ_BLOCK_SIZE: usize = 1 << 20;
+
+/// In-flight input blocks per worker; bounds pipeline memory while keeping
+/// every compressor busy
+const GZ_QUEUE_DEPTH: usize = 2;
+
+/// Block-parallel gzip encoder: tar bytes are cut into blocks, compressed
+/// on a pool of worker threads, and written out in order by a dedicated
+/// writer thread. Reading, compression, and archive writing overlap, so
+/// throughput scales with cores instead of pegging one on deflate.
+struct ParallelGzEncoder<W: Write + Send + 'static> {
+    buf: Vec<u8>,
+    next_seq: u64,
+    input_tx: Option<mpsc::SyncSender<(u64, Vec<u8>)>>,
+    workers: Vec<JoinHandle<()>>,
+    writer: Option<JoinHandle<io::Result<W>>>,
+}
+
+impl<W: Write + Send + 'static> ParallelGzEncoder<W> {
+    fn new(output: W, level: u32) -> Self {
+        let num_workers = thread::available_parallelism()
+            .map(|n| n.get())
+            .unwrap_or(1);
+
+        // Bounded input channel provides backpressure: the tar producer
+        // stalls instead of buffering the whole tree in memory
+        let (input_tx, input_rx) =
+            mpsc::sync_channel::<(u64, Vec<u8>)>(num_workers * GZ_QUEUE_DEPTH);
+        let input_rx = std::sync::Arc::new(std::sync::Mutex::new(input_rx));
+        let (output_tx, output_rx) = mpsc::sync_channel::<(u64, Vec<u8>)>(num_workers * GZ_QUEUE_DEPTH);
+
+        let workers = (0..num_workers)
+            .map(|_| {
+                let input_rx = std::sync::Arc::clone(&input_rx);
+                let output_tx = output_tx.clone();
+                thread::spawn(move || {
+                    loop {
+                        let (seq, block) = {
+                            let rx = input_rx.lock().expect("gzip input channel poisoned");
+                            match rx.recv() {
+                                Ok(work) => work,
+                                Err(_) => break, // producer finished
+                            }
+                        };
+
+                        let mut encoder =
+                            GzEncoder::new(Vec::new(), Compression::new(level));
+                        encoder.write_all(&block).expect("write to Vec cannot fail");
+                        let compressed =
+                            encoder.finish().expect("finish to Vec cannot fail");
+
+                        if output_tx.send((seq, compressed)).is_err() {
+                            break; // writer bailed on an IO error
+                        }
+                    }
+                })
+            })
+            .collect();
+        drop(output_tx);
+
+        // Writer thread reorders compressed blocks by sequence number so
+        // members land in the archive in input order
+        let writer = thread::spawn(move || -> io::Result<W> {
+            let mut output = output;
+            let mut pending: BTreeMap<u64, Vec<u8>> = BTreeMap::new();
+            let mut next_write = 0u64;
+
+            while let Ok((seq, compressed)) = output_rx.recv() {
+                pending.insert(seq, compressed);
+                while let Some(compressed) = pending.remove(&next_write) {
+                    output.write_all(&compressed)?;
+                    next_write += 1;
+                }
+            }
+
+            output.flush()?;
+            Ok(output)
+        });
+
+        Self {
+            buf: Vec::with_capacity(GZ_BLOCK_SIZE),
+            next_seq: 0,
+            input_tx: Some(input_tx),
+            workers,
+            writer: Some(writer),
+        }
+    }
+
+    fn dispatch(&mut self, block: Vec<u8>) -> io::Result<()> {
+        let tx = self
+            .input_tx
+            .as_ref()
+            .expect("dispatch after finish");
+        tx.send((self.next_seq, block))
+            .map_err(|_| io::Error::other("gzip worker threads exited early"))?;
+        self.next_seq += 1;
+        Ok(())
+    }
+
+    /// Flushes remaining data, drains the pipeline, and returns the
+    /// underlying writer. Surfaces any IO error from the writer thread.
+    fn finish(mut self) -> io::Result<W> {
+        self.shutdown()?
+            .ok_or_else(|| io::Error::other("gzip encoder already finished"))
+    }
+
+    fn shutdown(&mut self) -> io::Result<Option<W>> {
+        if self.input_tx.is_none() {
+            return Ok(None);
+        }
+
+        if !self.buf.is_empty() {
+            let block = std::mem::take(&mut self.buf);
+            self.dispatch(block)?;
+        }
+
+        // Closing the input channel lets the workers and then the writer
+        // thread drain and exit
+        drop(self.input_tx.take());
+        for worker in self.workers.drain(..) {
+            worker
+                .join()
+                .map_err(|_| io::Error::other("gzip worker thread panicked"))?;
+        }
+
+        let writer = self
+            .writer
+            .take()
+            .expect("writer thread missing")
+            .join()
+            .map_err(|_| io::Error::other("gzip writer thread panicked"))??;
+
+        Ok(Some(writer))
+    }
+}
+
+impl<W: Write + Send + 'static> Write for ParallelGzEncoder<W> {
+    fn write(&mut self, data: &[u8]) -> io::Result<usize> {
+        self.buf.extend_from_slice(data);
+        if self.buf.len() >= GZ_BLOCK_SIZE {
+            let block = std::mem::replace(&mut self.buf, Vec::with_capacity(GZ_BLOCK_SIZE));
+            self.dispatch(block)?;
+        }
+        Ok(data.len())
+    }
+
+    fn flush(&mut self) -> io::Result<()> {
+        // Partial blocks are held until finish(); flushing them early
+        // would fragment members and hurt the compression ratio
+        Ok(())
+    }
+}
+
+impl<W: Write + Send + 'static> Drop for ParallelGzEncoder<W> {
+    fn drop(&mut self) {
+        let _ = self.shutdown();
+    }
+}
+
 pub struct BackupManager {
     output_dir: PathBuf,
     compression_level: u32,
@@ -31,7 +197,7 @@ impl BackupManager {
         // Discover logs
         let home_dir = dirs::home_dir().context("Could not determine home directory")?;
         let discovery = LogDiscovery::new(home_dir.clone(), true);
-        let findings = discovery.scan()?;
+        let findings = discovery.scan_cached()?;
 
         // Filter by tool if specified
         let locations = if let Some(tool_name) = tool_filter.as_ref() {
@@ -79,9 +245,10 @@ impl BackupManager {
                 .progress_chars("#>-"),
         );
 
-        // Create tar.gz archive
+        // Create tar.gz archive; compression runs block-parallel across
+        // cores while this thread keeps feeding tar data
         let tar_gz = File::create(&backup_path)?;
-        let enc = GzEncoder::new(tar_gz, Compression::new(self.compression_level));
+        let enc = ParallelGzEncoder::new(tar_gz, self.compression_level);
         let mut tar = tar::Builder::new(enc);
 
         let mut files_added = 0u64;
@@ -134,6 +301,7 @@ impl BackupManager {
         }
 
         tar.finish()?;
+        tar.into_inner()?.finish()?;
         pb.finish_with_message("Done!");
 
         let backup_size = fs::metadata(&backup_path)?.len();
@@ -168,6 +336,33 @@ impl BackupManager {
     }
 }
 
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::io::Read;
+
+    #[test]
+    fn test_parallel_gz_roundtrip() {
+        // Several blocks worth of compressible data, plus a partial block
+        let input: Vec<u8> = (0..(GZ_BLOCK_SIZE * 3 + 1234))
+            .map(|i| (i % 251) as u8)
+            .collect();
+
+        let mut encoder = ParallelGzEncoder::new(Vec::new(), 6);
+        // Feed in small writes like tar does
+        for chunk in input.chunks(8192) {
+            encoder.write_all(chunk).unwrap();
+        }
+        let compressed = encoder.finish().unwrap();
+
+        let mut decoded = Vec::new();
+        flate2::read::MultiGzDecoder::new(&compressed[..])
+            .read_to_end(&mut decoded)
+            .unwrap();
+        assert_eq!(decoded, input);
+    }
+}
+
 /// Restore backup from archive
 pub fn restore_backup(backup_path: &PathBuf, output_dir: Option<PathBuf>) -> Result<()> {
     let restore_dir = output_dir.unwrap_or_else(|| {
@@ -181,7 +376,9 @@ pub fn restore_backup(backup_path: &PathBuf, output_dir: Option<PathBuf>) -> Res
     fs::create_dir_all(&restore_dir)?;
 
     let tar_gz = File::open(backup_path)?;
-    let tar = flate2::read::GzDecoder::new(tar_gz);
+    // MultiGzDecoder reads the multi-member streams parallel compression
+    // produces, and plain single-member archives from older backups
+    let tar = flate2::read::MultiGzDecoder::new(tar_gz);
     let mut archive = tar::Archive::new(tar);
 
     archive.unpack(&restore_dir)?;
@@ -1,6 +1,441 @@
 /// Behavioral Analysis - Understands what code DOES, not what functions it uses
-use std::collections::HashMap;
+use aho_corasick::AhoCorasick;
+use lazy_static::lazy_static;
 use regex::Regex;
+use std::collections::HashMap;
+
+/// Every literal needle the detectors below look for. All of them are
+/// compiled into one Aho-Corasick automaton and counted in a single pass
+/// over the code in `BehaviorAnalyzer::new`, instead of one full scan per
+/// `contains`/`matches` call site.
+const NEEDLES: &[&str] = &[
+    "tengu_bash_security_check_triggered",
+    "createElement",
+    "process.",
+    "Sync(",
+    ".join(",
+    ".slice(",
+    "JSON.",
+    "setTimeout",
+    "setInterval",
+    "Claude-Escapes",
+    "Claude-Steers",
+    "CLAUDE_CODE_BUBBLEWRAP",
+    "BASH_SANDBOX_SHOW_INDICATOR",
+    "API_KEY_FILE_DESCRIPTOR",
+    "API_KEY_HELPER",
+    "TTL_MS",
+    "AUTO_CONNECT_IDE",
+    "VSCODE_SETTINGS",
+    "DISABLE_COMMAND_INJECTION_CHECK",
+    "ADDITIONAL_PROTECTION",
+    "tengu_agent_",
+    "tengu_api_error",
+    "tengu_api_retry",
+    "tengu_accept_feedback",
+    "tengu_accept_submitted",
+    "tengu_agentic_search",
+    "tengu_search_",
+    "bindings:",
+    "bindings={",
+    "ctrl+",
+    "meta+",
+    "SENTRY_DSN",
+    "tracesSampleRate",
+    "escape:",
+    "confirm:",
+    "Confirmation",
+    "tengu_",
+    "HOST_HTTP_PROXY_PORT",
+    "HOST_SOCKS_PROXY_PORT",
+    "ENABLE_TELEMETRY",
+    "OTEL_FLUSH_TIMEOUT_MS",
+    "FILE_READ_MAX_OUTPUT_TOKENS",
+    "MAX_OUTPUT_TOKENS",
+    "MAX_RETRIES",
+    "CLAUDE_CODE",
+    "MAX_TOOL_USE_CONCURRENCY",
+    "ENABLE_PROMPT_SUGGESTION",
+    "tengu_prompt_suggestion",
+    "ENABLE_SDK_FILE_CHECKPOINTING",
+    "tengu_install_github_app",
+    "tengu_setup_github_actions",
+    "tengu_plan_exit",
+    "tengu_plan_",
+    "tengu_mcp_",
+    "tengu_tool_use_error",
+    "tengu_tool_use_success",
+    "tengu_version_lock_",
+    "tengu_oauth_",
+    "tengu_tree_sitter_load",
+    "tree-sitter",
+    "CLAUDE_CODE_",
+    "Input",
+    "Select",
+    "Form",
+    "Tab",
+    "Progress",
+    "Alert",
+    "Button",
+    "Dialog",
+    "Menu",
+    "http",
+    "request",
+    "response",
+    "endpoint",
+    "api",
+    "fetch",
+    "action",
+    "dispatch",
+    "selector",
+    "store",
+    "diff",
+    "merge",
+    "conflict",
+    "compact",
+    "teleport",
+    "PlaneService",
+    "CredentialsProvider",
+    "TypeError",
+    "ParameterError",
+    "ProviderError",
+    "RangeError",
+    "ServiceException",
+    "AbortError",
+    "SyntaxError",
+    "TimeoutError",
+    "UnknownError",
+    "QueryError",
+    "ReferenceError",
+    "ParseError",
+    "ResponseError",
+    "RequestError",
+    "InternalError",
+    "TokenException",
+    "ServerException",
+    "AxiosError",
+    "ParserError",
+    "AuthError",
+    "HmacDRBG",
+    "KeyPair",
+    "keyPair",
+    "function EC(",
+    "new EC(",
+    "Signature",
+    ".curve",
+    "precompute",
+    "createErrorType",
+    "NodeError",
+    "codes[",
+    "getMessage",
+    "ushrn",
+    "bitLength",
+    ".nh",
+    "result",
+    "<<",
+    ">>",
+    "keyword:",
+    "literal:",
+    "built_in:",
+    "decodeURI",
+    "encodeURI",
+    "__REACT_DEVTOOLS_GLOBAL_HOOK__",
+    "getInternalModuleRanges",
+    "getDisplayNameForFiber",
+    "getIsProfiling",
+    "--profiler-v",
+    "--react-version",
+    "api_error",
+    "ApiError",
+    "API_ERROR",
+    "recovery",
+    "recover",
+    "retry",
+    "Retry",
+    "fallback",
+    "Fallback",
+    "unhandledRejection",
+    "PromiseRejection",
+    "promise.reject",
+    "promiseError",
+    "RegExp(",
+    "new RegExp",
+    ".test(",
+    ".exec(",
+    "RegExp",
+    "timestamp",
+    "toISOString",
+    "Date.now",
+    "Sync",
+    "readFileSync",
+    "writeFileSync",
+    "existsSync",
+    "image",
+    "Image",
+    "canvas",
+    "Canvas",
+    "png",
+    "jpg",
+    "jpeg",
+    "weekStartsOn",
+    "getFullYear",
+    "Date.UTC",
+    "locale?.options",
+    "setHours(0,0,0,0)",
+    "leading",
+    "trailing",
+    "maxWait",
+    "clearTimeout",
+    "debounce",
+    "throttle",
+    "type:'brace'",
+    "type:'paren'",
+    "JSON.parse",
+    "{type:",
+    "startup",
+    "startTime",
+    "getEntriesByType('mark')",
+    "profiling",
+    "Performance",
+    "startup-perf",
+    "getOwnPropertyDescriptor",
+    "getOwnPropertyNames",
+    "__proto__",
+    "constructor?.name",
+    "constructor.name",
+    "toISOString()",
+    "infix infixl infixr",
+    "infixl",
+    "infixr",
+    "port",
+    "keywords",
+    "illegal:/;/",
+    "illegal: /;/",
+    "[object ",
+    "[object Array]",
+    "[object Function]",
+    "[object RegExp]",
+    "9007199254740991",
+    ".subscribe(",
+    ".unsubscribe()",
+    "Observable",
+    "Subject",
+    "createOperatorSubscriber",
+    ".operate(function",
+    "subscribe",
+    "hexToBinary",
+    "hrTimeToNanos",
+    "encodeAsLongBits",
+    "createInstrumentationScope",
+    "createResource",
+    "toAnyValue",
+    "toAttributes",
+    "BigInt.asUintN",
+    "low:",
+    "high:",
+    "Z_MIN_WINDOWBITS",
+    "Z_DEFAULT_CHUNK",
+    "Z_MAX_LEVEL",
+    "deflate",
+    "inflate",
+    "gzip",
+    "gunzip",
+    "Homebrew",
+    "Caskroom",
+    "winget",
+    "Microsoft/WinGet",
+    "npm config get prefix",
+    "process.execPath",
+    "node_modules",
+    "/opt/homebrew/",
+    ".nvm/versions",
+    "api.anthropic.com",
+    "CLAUDE_CODE_USE_BEDROCK",
+    "CLAUDE_CODE_USE_VERTEX",
+    "CLAUDE_CODE_USE_FOUNDRY",
+    "Error fetching session logs",
+    "session_get_fail_status",
+    "isConnected",
+    "EHOSTUNREACH",
+    "typeof",
+    "Object.keys",
+    "Object.getOwnPropertySymbols",
+    "T.valueOf==",
+    "$.valueOf()",
+    "S.valueOf",
+    "T===0?T:0",
+    "S===S?",
+    "T===T?T:0",
+    "function",
+    "(T,S)",
+    "(T)",
+    "createCipher",
+    "createCipheriv",
+    "createHash",
+    "createHmac",
+    "createSign",
+    "createVerify",
+    "DiffieHellman",
+    "createECDH",
+    "browserify",
+    "Browserify",
+    "Cipher",
+    "Hash",
+    "Sign",
+    "asn1.",
+    ".encoders",
+    ".decoders",
+    ".bignum",
+    ".define",
+    "elliptic.",
+    ".ec",
+    ".eddsa",
+    ".utils",
+    "hash.",
+    ".sha",
+    ".ripemd",
+    ".hmac",
+    "2.16.840.1.101",
+    "aes-",
+    "des-",
+    "rsa-",
+    "exports.",
+    "module.exports",
+    "Hmac",
+    "Verify",
+    "ECDH",
+    "highlight.js",
+    "hljs",
+    "Prism",
+    "language-",
+    "z.object",
+    "yup.object",
+    "Joi.object",
+    "AccessKeyId",
+    "SecretAccessKey",
+    "SessionToken",
+    "credential",
+    "Cognito",
+    "Identity",
+    "Pool",
+    "apiKey",
+    "api_key",
+    "header",
+    "Authorization",
+    "OAuth",
+    "callback",
+    "JWT",
+    "refresh",
+    "jsonwebtoken",
+    "session",
+    "cookie",
+    "SAML",
+    "MFA",
+    "2FA",
+    "twoFactor",
+    "verify",
+    "code",
+    "google",
+    "sign",
+    "facebook",
+    "login",
+    "try{",
+    "catch(",
+    "throw ",
+    "new Error(",
+    "new TypeError(",
+    "new RangeError(",
+    "handleError",
+    "errorHandler",
+    "onError",
+    "catchError",
+    "rate",
+    "exponential",
+    "API",
+    "network",
+    "metric",
+    "aggregate",
+    "track",
+    "user",
+    "performance",
+    "plan",
+    "Plan",
+    "RBAC",
+    "role",
+    "ACL",
+    "file",
+    "path",
+    "Claude-",
+    "HTTP",
+    "WebSocket",
+    "ws://",
+    "gRPC",
+    "step",
+    "pipeline",
+    "saga",
+    "task",
+    "queue",
+    "workflow",
+    "state",
+    "GraphQL",
+    "REST",
+    "RESTful",
+    "axios",
+    "RabbitMQ",
+    "AMQP",
+    "Kafka",
+    "topic",
+    "pool",
+    "connection",
+    "memory",
+    "limit",
+    "thread",
+    "worker",
+    "descriptor",
+    ".env",
+    "dotenv",
+    "yaml",
+    "YAML",
+    "json",
+    "parse",
+    "secret",
+    "vault",
+    "winston",
+    "pino",
+    "structured",
+    "log",
+    "rotate",
+    "Redis",
+    "Memcached",
+    "LRU",
+    "TTL",
+    "expire",
+    "XQuery",
+    "XPath",
+    "TypeScript",
+    "JavaScript",
+    "Python",
+    "SQL",
+    "XML",
+    "HTML",
+    "CSS",
+    "AST",
+    "lexer",
+    "email",
+    "url",
+    "URL",
+    "datetime",
+    "date",
+    "password",
+    "phone",
+];
+
+lazy_static! {
+    static ref NEEDLE_AUTOMATON: AhoCorasick =
+        AhoCorasick::new(NEEDLES).expect("needle patterns compile");
+    static ref NEEDLE_INDEX: HashMap<&'static str, usize> =
+        NEEDLES.iter().enumerate().map(|(i, n)| (*n, i)).collect();
+}
 
 #[derive(Debug, Clone)]
 pub struct BehaviorProfile {
@@ -248,11 +683,42 @@ pub enum CodeCategory {
 
 pub struct BehaviorAnalyzer {
     code: String,
+    needle_counts: Vec<usize>,
 }
 
 impl BehaviorAnalyzer {
     pub fn new(code: String) -> Self {
-        Self { code }
+        let mut needle_counts = vec![0usize; NEEDLES.len()];
+        // Track where the previous counted match of each pattern ended so
+        // the counts reproduce `str::matches` (leftmost, non-overlapping)
+        // semantics exactly, even for self-overlapping needles.
+        let mut last_end = vec![0usize; NEEDLES.len()];
+        for m in NEEDLE_AUTOMATON.find_overlapping_iter(&code) {
+            let id = m.pattern().as_usize();
+            if m.start() >= last_end[id] {
+                needle_counts[id] += 1;
+                last_end[id] = m.end();
+            }
+        }
+        Self {
+            code,
+            needle_counts,
+        }
+    }
+
+    /// Single-pass replacement for `self.code.contains(needle)`.
+    fn contains(&self, needle: &str) -> bool {
+        self.count(needle) > 0
+    }
+
+    /// Single-pass replacement for `self.code.matches(needle).count()`.
+    /// Needles outside the registry (dynamic strings) fall back to a
+    /// direct scan.
+    fn count(&self, needle: &str) -> usize {
+        match NEEDLE_INDEX.get(needle) {
+            Some(&id) => self.needle_counts[id],
+            None => self.code.matches(needle).count(),
+        }
     }
 
     /// Main analysis: What does this code actually DO?
@@ -306,7 +772,7 @@ impl BehaviorAnalyzer {
         self.analyze_protocol(&mut scores, &mut evidence);
 
         // DEBUG: Print all scores if bash security is detected
-        if self.code.contains("tengu_bash_security_check_triggered") {
+        if self.contains("tengu_bash_security_check_triggered") {
             eprintln!("\n=== BASH SECURITY CODE DETECTED ===");
             let mut sorted_scores: Vec<_> = scores.iter().collect();
             sorted_scores.sort_by(|a, b| b.1.partial_cmp(a.1).unwrap());
@@ -335,7 +801,7 @@ impl BehaviorAnalyzer {
 
     /// Detect React patterns
     fn analyze_react(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
-        let create_element_count = self.code.matches("createElement").count();
+        let create_element_count = self.count("createElement");
         if create_element_count > 5 {
             *scores.entry(CodeCategory::ReactComponent).or_insert(0.0) += (create_element_count as f64 * 0.1).min(3.0);
             evidence.push(format!("React ({} createElement)", create_element_count));
@@ -343,7 +809,7 @@ impl BehaviorAnalyzer {
     }
 
     fn analyze_process(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
-        let process_count = self.code.matches("process.").count();
+        let process_count = self.count("process.");
         if process_count > 5 {
             *scores.entry(CodeCategory::ProcessManager).or_insert(0.0) += (process_count as f64 * 0.1).min(2.0);
             evidence.push("Process management".to_string());
@@ -351,7 +817,7 @@ impl BehaviorAnalyzer {
     }
 
     fn analyze_filesystem(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
-        let fs_count = self.code.matches("Sync(").count();
+        let fs_count = self.count("Sync(");
         if fs_count > 3 {
             *scores.entry(CodeCategory::FileSystemSync).or_insert(0.0) += (fs_count as f64 * 0.2).min(2.0);
             evidence.push("File system operations".to_string());
@@ -359,7 +825,7 @@ impl BehaviorAnalyzer {
     }
 
     fn analyze_string_ops(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
-        let str_ops = self.code.matches(".join(").count() + self.code.matches(".slice(").count();
+        let str_ops = self.count(".join(") + self.count(".slice(");
         if str_ops > 10 {
             *scores.entry(CodeCategory::StringManipulator).or_insert(0.0) += (str_ops as f64 * 0.05).min(2.0);
             evidence.push("String operations".to_string());
@@ -367,7 +833,7 @@ impl BehaviorAnalyzer {
     }
 
     fn analyze_data_parsing(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
-        let json_count = self.code.matches("JSON.").count();
+        let json_count = self.count("JSON.");
         if json_count > 2 {
             *scores.entry(CodeCategory::JSONParser).or_insert(0.0) += (json_count as f64 * 0.3).min(2.0);
             evidence.push("JSON parsing".to_string());
@@ -375,7 +841,7 @@ impl BehaviorAnalyzer {
     }
 
     fn analyze_timing(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
-        let timer_count = self.code.matches("setTimeout").count() + self.code.matches("setInterval").count();
+        let timer_count = self.count("setTimeout") + self.count("setInterval");
         if timer_count > 0 {
             *scores.entry(CodeCategory::TimerScheduler).or_insert(0.0) += timer_count as f64 * 0.4;
             evidence.push("Timer scheduling".to_string());
@@ -384,185 +850,185 @@ impl BehaviorAnalyzer {
 
     fn analyze_claude_specific(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
         // Claude Protocol Headers
-        if self.code.contains("Claude-Escapes") || self.code.contains("Claude-Steers") {
+        if self.contains("Claude-Escapes") || self.contains("Claude-Steers") {
             *scores.entry(CodeCategory::ClaudeProtocolHandler).or_insert(0.0) += 2.5;
             evidence.push("Claude protocol headers".to_string());
         }
 
         // Sandbox Management (highest specificity)
-        if self.code.contains("CLAUDE_CODE_BUBBLEWRAP") || self.code.contains("BASH_SANDBOX_SHOW_INDICATOR") {
+        if self.contains("CLAUDE_CODE_BUBBLEWRAP") || self.contains("BASH_SANDBOX_SHOW_INDICATOR") {
             *scores.entry(CodeCategory::SandboxManager).or_insert(0.0) += 10.0;
             evidence.push("Sandbox management (BUBBLEWRAP)".to_string());
         }
 
         // API Key Vault
-        if self.code.contains("API_KEY_FILE_DESCRIPTOR") ||
-           (self.code.contains("API_KEY_HELPER") && self.code.contains("TTL_MS")) {
+        if self.contains("API_KEY_FILE_DESCRIPTOR") ||
+           (self.contains("API_KEY_HELPER") && self.contains("TTL_MS")) {
             *scores.entry(CodeCategory::APIKeyVault).or_insert(0.0) += 10.0;
             evidence.push("API Key Vault".to_string());
         }
 
         // IDE Connector
-        if self.code.contains("AUTO_CONNECT_IDE") || self.code.contains("VSCODE_SETTINGS") {
+        if self.contains("AUTO_CONNECT_IDE") || self.contains("VSCODE_SETTINGS") {
             *scores.entry(CodeCategory::IDEConnector).or_insert(0.0) += 2.5;
             evidence.push("IDE connector".to_string());
         }
 
         // Command Injection Guard
-        if self.code.contains("DISABLE_COMMAND_INJECTION_CHECK") || self.code.contains("ADDITIONAL_PROTECTION") {
+        if self.contains("DISABLE_COMMAND_INJECTION_CHECK") || self.contains("ADDITIONAL_PROTECTION") {
             *scores.entry(CodeCategory::CommandInjectionGuard).or_insert(0.0) += 2.5;
             evidence.push("Command injection guard".to_string());
         }
 
         // Agent Telemetry (specific tengu_ events)
-        if self.code.contains("tengu_agent_") {
+        if self.contains("tengu_agent_") {
             *scores.entry(CodeCategory::AgentTelemetryRecorder).or_insert(0.0) += 2.5;
             evidence.push("Agent telemetry (tengu_agent_)".to_string());
         }
 
         // API Monitoring
-        if self.code.contains("tengu_api_error") || self.code.contains("tengu_api_retry") {
+        if self.contains("tengu_api_error") || self.contains("tengu_api_retry") {
             *scores.entry(CodeCategory::APIMonitoringDashboard).or_insert(0.0) += 2.5;
             evidence.push("API monitoring (tengu_api_)".to_string());
         }
 
         // Feedback Collection
-        if self.code.contains("tengu_accept_feedback") || self.code.contains("tengu_accept_submitted") {
+        if self.contains("tengu_accept_feedback") || self.contains("tengu_accept_submitted") {
             *scores.entry(CodeCategory::FeedbackCollectionSystem).or_insert(0.0) += 2.5;
             evidence.push("Feedback collection".to_string());
         }
 
         // Search Analytics
-        if self.code.contains("tengu_agentic_search") || self.code.contains("tengu_search_") {
+        if self.contains("tengu_agentic_search") || self.contains("tengu_search_") {
             *scores.entry(CodeCategory::SearchAnalytics).or_insert(0.0) += 2.5;
             evidence.push("Search analytics".to_string());
         }
 
         // Keyboard Shortcuts (HIGHEST specificity - data structure pattern)
-        if (self.code.contains("bindings:") || self.code.contains("bindings={")) &&
-           (self.code.contains("ctrl+") || self.code.contains("meta+")) {
+        if (self.contains("bindings:") || self.contains("bindings={")) &&
+           (self.contains("ctrl+") || self.contains("meta+")) {
             *scores.entry(CodeCategory::KeyboardShortcutManager).or_insert(0.0) += 10.0;
             evidence.push("Keyboard shortcut bindings".to_string());
         }
 
         // Command Palette
-        if (self.code.contains("\"app:") || self.code.contains("\"chat:")) &&
-           self.code.contains("\"escape") {
+        if (self.contains("\"app:") || self.contains("\"chat:")) &&
+           self.contains("\"escape") {
             *scores.entry(CodeCategory::CommandPaletteHandler).or_insert(0.0) += 2.5;
             evidence.push("Command palette (app:*, chat:*)".to_string());
         }
 
         // Sentry Integration (HIGHEST specificity - unique string combo)
-        if self.code.contains("SENTRY_DSN") && self.code.contains("tracesSampleRate") {
+        if self.contains("SENTRY_DSN") && self.contains("tracesSampleRate") {
             *scores.entry(CodeCategory::SentryIntegration).or_insert(0.0) += 10.0;
             evidence.push("Sentry error tracking".to_string());
         }
 
         // Modal Dialog (escape + confirmation patterns)
-        if self.code.contains("escape:") &&
-           (self.code.contains("confirm:") || self.code.contains("Confirmation")) {
+        if self.contains("escape:") &&
+           (self.contains("confirm:") || self.contains("Confirmation")) {
             *scores.entry(CodeCategory::ModalDialogController).or_insert(0.0) += 2.0;
             evidence.push("Modal dialog controller".to_string());
         }
 
         // Generic Claude telemetry (fallback)
-        if self.code.contains("tengu_") {
+        if self.contains("tengu_") {
             *scores.entry(CodeCategory::ClaudeTelemetryRecorder).or_insert(0.0) += 1.0;
             evidence.push("Claude telemetry (generic)".to_string());
         }
 
         // Proxy Manager
-        if self.code.contains("HOST_HTTP_PROXY_PORT") || self.code.contains("HOST_SOCKS_PROXY_PORT") {
+        if self.contains("HOST_HTTP_PROXY_PORT") || self.contains("HOST_SOCKS_PROXY_PORT") {
             *scores.entry(CodeCategory::ProxyManager).or_insert(0.0) += 10.0;
             evidence.push("Proxy manager (HTTP/SOCKS)".to_string());
         }
 
         // Telemetry Controller
-        if self.code.contains("ENABLE_TELEMETRY") || self.code.contains("OTEL_FLUSH_TIMEOUT_MS") {
+        if self.contains("ENABLE_TELEMETRY") || self.contains("OTEL_FLUSH_TIMEOUT_MS") {
             *scores.entry(CodeCategory::TelemetryController).or_insert(0.0) += 2.5;
             evidence.push("Telemetry controller".to_string());
         }
 
         // Token Budget Manager
-        if self.code.contains("FILE_READ_MAX_OUTPUT_TOKENS") || self.code.contains("MAX_OUTPUT_TOKENS") {
+        if self.contains("FILE_READ_MAX_OUTPUT_TOKENS") || self.contains("MAX_OUTPUT_TOKENS") {
             *scores.entry(CodeCategory::TokenBudgetManager).or_insert(0.0) += 10.0;
             evidence.push("Token budget manager".to_string());
         }
 
         // Retry Policy
-        if self.code.contains("MAX_RETRIES") && self.code.contains("CLAUDE_CODE") {
+        if self.contains("MAX_RETRIES") && self.contains("CLAUDE_CODE") {
             *scores.entry(CodeCategory::RetryPolicy).or_insert(0.0) += 2.5;
             evidence.push("Retry policy".to_string());
         }
 
         // Tool Concurrency Limiter
-        if self.code.contains("MAX_TOOL_USE_CONCURRENCY") {
+        if self.contains("MAX_TOOL_USE_CONCURRENCY") {
             *scores.entry(CodeCategory::ToolConcurrencyLimiter).or_insert(0.0) += 10.0;
             evidence.push("Tool concurrency limiter".to_string());
         }
 
         // Prompt Suggestion Engine
-        if self.code.contains("ENABLE_PROMPT_SUGGESTION") || self.code.contains("tengu_prompt_suggestion") {
+        if self.contains("ENABLE_PROMPT_SUGGESTION") || self.contains("tengu_prompt_suggestion") {
             *scores.entry(CodeCategory::PromptSuggestionEngine).or_insert(0.0) += 2.5;
             evidence.push("Prompt suggestion engine".to_string());
         }
 
         // SDK Checkpointing
-        if self.code.contains("ENABLE_SDK_FILE_CHECKPOINTING") {
+        if self.contains("ENABLE_SDK_FILE_CHECKPOINTING") {
             *scores.entry(CodeCategory::SDKCheckpointing).or_insert(0.0) += 2.5;
             evidence.push("SDK checkpointing".to_string());
         }
 
         // Bash Security Monitor (52 occurrences!) - HIGHEST SPECIFICITY
-        if self.code.contains("tengu_bash_security_check_triggered") {
+        if self.contains("tengu_bash_security_check_triggered") {
             *scores.entry(CodeCategory::BashSecurityMonitor).or_insert(0.0) += 10.0;
             evidence.push("Bash security monitor".to_string());
         }
 
         // GitHub Integration Tracker
-        if self.code.contains("tengu_install_github_app") || self.code.contains("tengu_setup_github_actions") {
+        if self.contains("tengu_install_github_app") || self.contains("tengu_setup_github_actions") {
             *scores.entry(CodeCategory::GitHubIntegrationTracker).or_insert(0.0) += 2.5;
             evidence.push("GitHub integration tracker".to_string());
         }
 
         // Plan Mode Analytics
-        if self.code.contains("tengu_plan_exit") || self.code.contains("tengu_plan_") {
+        if self.contains("tengu_plan_exit") || self.contains("tengu_plan_") {
             *scores.entry(CodeCategory::PlanModeAnalytics).or_insert(0.0) += 2.5;
             evidence.push("Plan mode analytics".to_string());
         }
 
         // MCP Operation Tracker
-        if self.code.contains("tengu_mcp_") {
+        if self.contains("tengu_mcp_") {
             *scores.entry(CodeCategory::MCPOperationTracker).or_insert(0.0) += 2.5;
             evidence.push("MCP operation tracker".to_string());
         }
 
         // Tool Use Monitor
-        if self.code.contains("tengu_tool_use_error") || self.code.contains("tengu_tool_use_success") {
+        if self.contains("tengu_tool_use_error") || self.contains("tengu_tool_use_success") {
             *scores.entry(CodeCategory::ToolUseMonitor).or_insert(0.0) += 2.5;
             evidence.push("Tool use monitor".to_string());
         }
 
         // Version Lock Tracker
-        if self.code.contains("tengu_version_lock_") {
+        if self.contains("tengu_version_lock_") {
             *scores.entry(CodeCategory::VersionLockTracker).or_insert(0.0) += 2.5;
             evidence.push("Version lock tracker".to_string());
         }
 
         // OAuth Flow Tracker
-        if self.code.contains("tengu_oauth_") {
+        if self.contains("tengu_oauth_") {
             *scores.entry(CodeCategory::OAuthFlowTracker).or_insert(0.0) += 2.5;
             evidence.push("OAuth flow tracker".to_string());
         }
 
         // Tree-sitter Loader
-        if self.code.contains("tengu_tree_sitter_load") || self.code.contains("tree-sitter") {
+        if self.contains("tengu_tree_sitter_load") || self.contains("tree-sitter") {
             *scores.entry(CodeCategory::TreeSitterLoader).or_insert(0.0) += 2.5;
             evidence.push("Tree-sitter parser loader".to_string());
         }
 
         // Generic environment loader (fallback)
-        let claude_env_count = self.code.matches("CLAUDE_CODE_").count();
+        let claude_env_count = self.count("CLAUDE_CODE_");
         if claude_env_count > 3 {
             *scores.entry(CodeCategory::ClaudeEnvironmentLoader).or_insert(0.0) += (claude_env_count as f64 * 0.2).min(1.5);
             evidence.push(format!("Claude environment ({} vars)", claude_env_count));
@@ -572,63 +1038,63 @@ impl BehaviorAnalyzer {
     /// Analyze React UI components (Iteration 5 discoveries)
     fn analyze_react_components(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
         // Input components (1153 occurrences!)
-        let input_count = self.code.matches("Input").count();
+        let input_count = self.count("Input");
         if input_count >= 5 {
             *scores.entry(CodeCategory::InputComponentLibrary).or_insert(0.0) += (input_count as f64 * 0.3).min(10.0);
             evidence.push(format!("Input component library ({} refs)", input_count));
         }
 
         // Select components (1128 occurrences!)
-        let select_count = self.code.matches("Select").count();
+        let select_count = self.count("Select");
         if select_count >= 5 {
             *scores.entry(CodeCategory::SelectComponentLibrary).or_insert(0.0) += (select_count as f64 * 0.3).min(10.0);
             evidence.push(format!("Select component library ({} refs)", select_count));
         }
 
         // Form components (953 occurrences!)
-        let form_count = self.code.matches("Form").count();
+        let form_count = self.count("Form");
         if form_count >= 5 {
             *scores.entry(CodeCategory::FormComponentLibrary).or_insert(0.0) += (form_count as f64 * 0.3).min(10.0);
             evidence.push(format!("Form component library ({} refs)", form_count));
         }
 
         // Tab navigation (737 occurrences!)
-        let tab_count = self.code.matches("Tab").count();
+        let tab_count = self.count("Tab");
         if tab_count >= 5 {
             *scores.entry(CodeCategory::TabNavigationSystem).or_insert(0.0) += (tab_count as f64 * 0.3).min(8.0);
             evidence.push(format!("Tab navigation ({} refs)", tab_count));
         }
 
         // Progress indicators (424 occurrences!)
-        let progress_count = self.code.matches("Progress").count();
+        let progress_count = self.count("Progress");
         if progress_count >= 5 {
             *scores.entry(CodeCategory::ProgressIndicatorSystem).or_insert(0.0) += (progress_count as f64 * 0.3).min(8.0);
             evidence.push(format!("Progress indicators ({} refs)", progress_count));
         }
 
         // Alert/notification system (220 occurrences!)
-        let alert_count = self.code.matches("Alert").count();
+        let alert_count = self.count("Alert");
         if alert_count >= 3 {
             *scores.entry(CodeCategory::AlertNotificationSystem).or_insert(0.0) += (alert_count as f64 * 0.4).min(8.0);
             evidence.push(format!("Alert system ({} refs)", alert_count));
         }
 
         // Button library (211 occurrences!)
-        let button_count = self.code.matches("Button").count();
+        let button_count = self.count("Button");
         if button_count >= 3 {
             *scores.entry(CodeCategory::ButtonComponentLibrary).or_insert(0.0) += (button_count as f64 * 0.4).min(8.0);
             evidence.push(format!("Button library ({} refs)", button_count));
         }
 
         // Dialog components (200 occurrences!)
-        let dialog_count = self.code.matches("Dialog").count();
+        let dialog_count = self.count("Dialog");
         if dialog_count >= 3 {
             *scores.entry(CodeCategory::DialogComponentLibrary).or_insert(0.0) += (dialog_count as f64 * 0.4).min(8.0);
             evidence.push(format!("Dialog components ({} refs)", dialog_count));
         }
 
         // Menu components (136 occurrences!)
-        let menu_count = self.code.matches("Menu").count();
+        let menu_count = self.count("Menu");
         if menu_count >= 3 {
             *scores.entry(CodeCategory::MenuComponentLibrary).or_insert(0.0) += (menu_count as f64 * 0.4).min(7.0);
             evidence.push(format!("Menu components ({} refs)", menu_count));
@@ -638,36 +1104,36 @@ impl BehaviorAnalyzer {
     /// Analyze network/API layer (Iteration 5 discoveries)
     fn analyze_network_layer(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
         // HTTP request management (4176 http, 2449 request!)
-        let http_count = self.code.matches("http").count();
-        let request_count = self.code.matches("request").count();
+        let http_count = self.count("http");
+        let request_count = self.count("request");
         if http_count >= 10 || request_count >= 10 {
             *scores.entry(CodeCategory::HTTPRequestManager).or_insert(0.0) += ((http_count + request_count) as f64 * 0.05).min(10.0);
             evidence.push(format!("HTTP request manager ({} http, {} request)", http_count, request_count));
         }
 
         // HTTP response handling (1451 response!)
-        let response_count = self.code.matches("response").count();
+        let response_count = self.count("response");
         if response_count >= 10 {
             *scores.entry(CodeCategory::HTTPResponseHandler).or_insert(0.0) += (response_count as f64 * 0.1).min(10.0);
             evidence.push(format!("HTTP response handler ({} refs)", response_count));
         }
 
         // Endpoint registry (1055 endpoint!)
-        let endpoint_count = self.code.matches("endpoint").count();
+        let endpoint_count = self.count("endpoint");
         if endpoint_count >= 5 {
             *scores.entry(CodeCategory::EndpointRegistry).or_insert(0.0) += (endpoint_count as f64 * 0.2).min(9.0);
             evidence.push(format!("Endpoint registry ({} refs)", endpoint_count));
         }
 
         // API client library (1080 api!)
-        let api_count = self.code.matches("api").count();
+        let api_count = self.count("api");
         if api_count >= 10 {
             *scores.entry(CodeCategory::APIClientLibrary).or_insert(0.0) += (api_count as f64 * 0.1).min(9.0);
             evidence.push(format!("API client library ({} refs)", api_count));
         }
 
         // Fetch API wrapper (709 fetch!)
-        let fetch_count = self.code.matches("fetch").count();
+        let fetch_count = self.count("fetch");
         if fetch_count >= 5 {
             *scores.entry(CodeCategory::FetchAPIWrapper).or_insert(0.0) += (fetch_count as f64 * 0.2).min(8.0);
             evidence.push(format!("Fetch API wrapper ({} refs)", fetch_count));
@@ -677,22 +1143,22 @@ impl BehaviorAnalyzer {
     /// Analyze state management patterns (Iteration 5 discoveries)
     fn analyze_state_patterns(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
         // Action dispatcher (1810 action, 179 dispatch!)
-        let action_count = self.code.matches("action").count();
-        let dispatch_count = self.code.matches("dispatch").count();
+        let action_count = self.count("action");
+        let dispatch_count = self.count("dispatch");
         if action_count >= 10 || dispatch_count >= 5 {
             *scores.entry(CodeCategory::ActionDispatcher).or_insert(0.0) += ((action_count + dispatch_count * 2) as f64 * 0.05).min(10.0);
             evidence.push(format!("Action dispatcher ({} actions, {} dispatch)", action_count, dispatch_count));
         }
 
         // State selector (168 selector!)
-        let selector_count = self.code.matches("selector").count();
+        let selector_count = self.count("selector");
         if selector_count >= 5 {
             *scores.entry(CodeCategory::StateSelector).or_insert(0.0) += (selector_count as f64 * 0.3).min(8.0);
             evidence.push(format!("State selector ({} refs)", selector_count));
         }
 
         // Store manager (410 store!)
-        let store_count = self.code.matches("store").count();
+        let store_count = self.count("store");
         if store_count >= 5 {
             *scores.entry(CodeCategory::StoreManagerCore).or_insert(0.0) += (store_count as f64 * 0.2).min(8.0);
             evidence.push(format!("Store manager ({} refs)", store_count));
@@ -702,29 +1168,29 @@ impl BehaviorAnalyzer {
     /// Analyze editor features (Iteration 5 discoveries)
     fn analyze_editor_features(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
         // Diff viewer (601 diff!)
-        let diff_count = self.code.matches("diff").count();
+        let diff_count = self.count("diff");
         if diff_count >= 5 {
             *scores.entry(CodeCategory::DiffViewerComponent).or_insert(0.0) += (diff_count as f64 * 0.3).min(9.0);
             evidence.push(format!("Diff viewer ({} refs)", diff_count));
         }
 
         // Merge conflict resolver (635 merge, 62 conflict!)
-        let merge_count = self.code.matches("merge").count();
-        let conflict_count = self.code.matches("conflict").count();
+        let merge_count = self.count("merge");
+        let conflict_count = self.count("conflict");
         if merge_count >= 5 || conflict_count >= 3 {
             *scores.entry(CodeCategory::MergeConflictResolver).or_insert(0.0) += ((merge_count + conflict_count * 2) as f64 * 0.1).min(9.0);
             evidence.push(format!("Merge resolver ({} merge, {} conflict)", merge_count, conflict_count));
         }
 
         // Compact operation (353 compact!)
-        let compact_count = self.code.matches("compact").count();
+        let compact_count = self.count("compact");
         if compact_count >= 5 {
             *scores.entry(CodeCategory::CompactOperationManager).or_insert(0.0) += (compact_count as f64 * 0.3).min(8.0);
             evidence.push(format!("Compact operations ({} refs)", compact_count));
         }
 
         // Teleport navigator (112 teleport!)
-        let teleport_count = self.code.matches("teleport").count();
+        let teleport_count = self.count("teleport");
         if teleport_count >= 3 {
             *scores.entry(CodeCategory::TeleportNavigator).or_insert(0.0) += (teleport_count as f64 * 0.5).min(8.0);
             evidence.push(format!("Teleport navigator ({} refs)", teleport_count));
@@ -734,14 +1200,14 @@ impl BehaviorAnalyzer {
     /// Analyze service architecture (Iteration 5 discoveries)
     fn analyze_services(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
         // Plane service (188 PlaneService!)
-        let plane_count = self.code.matches("PlaneService").count();
+        let plane_count = self.count("PlaneService");
         if plane_count >= 3 {
             *scores.entry(CodeCategory::PlaneServiceCoordinator).or_insert(0.0) += (plane_count as f64 * 0.5).min(9.0);
             evidence.push(format!("Plane service ({} refs)", plane_count));
         }
 
         // Credentials provider (112 CredentialsProvider!)
-        let creds_count = self.code.matches("CredentialsProvider").count();
+        let creds_count = self.count("CredentialsProvider");
         if creds_count >= 3 {
             *scores.entry(CodeCategory::CredentialsProviderSystem).or_insert(0.0) += (creds_count as f64 * 0.5).min(9.0);
             evidence.push(format!("Credentials provider ({} refs)", creds_count));
@@ -751,35 +1217,35 @@ impl BehaviorAnalyzer {
     /// Analyze specific error types (Iteration 6 discoveries)
     fn analyze_error_types(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
         // TypeError (1457 occurrences!)
-        let type_error_count = self.code.matches("TypeError").count();
+        let type_error_count = self.count("TypeError");
         if type_error_count >= 3 {
             *scores.entry(CodeCategory::TypeErrorHandler).or_insert(0.0) += (type_error_count as f64 * 0.5).min(10.0);
             evidence.push(format!("TypeError handler ({} errors)", type_error_count));
         }
 
         // ParameterError (350 occurrences!)
-        let param_error_count = self.code.matches("ParameterError").count();
+        let param_error_count = self.count("ParameterError");
         if param_error_count >= 2 {
             *scores.entry(CodeCategory::ParameterErrorHandler).or_insert(0.0) += (param_error_count as f64 * 0.7).min(9.0);
             evidence.push(format!("ParameterError handler ({} errors)", param_error_count));
         }
 
         // ProviderError (156 occurrences!)
-        let provider_error_count = self.code.matches("ProviderError").count();
+        let provider_error_count = self.count("ProviderError");
         if provider_error_count >= 2 {
             *scores.entry(CodeCategory::ProviderErrorHandler).or_insert(0.0) += (provider_error_count as f64 * 0.8).min(9.0);
             evidence.push(format!("ProviderError handler ({} errors)", provider_error_count));
         }
 
         // RangeError (144 occurrences!)
-        let range_error_count = self.code.matches("RangeError").count();
+        let range_error_count = self.count("RangeError");
         if range_error_count >= 2 {
             *scores.entry(CodeCategory::RangeErrorHandler).or_insert(0.0) += (range_error_count as f64 * 0.8).min(8.0);
             evidence.push(format!("RangeError handler ({} errors)", range_error_count));
         }
 
         // ServiceException (112 occurrences!)
-        let service_exc_count = self.code.matches("ServiceException").count();
+        let service_exc_count = self.count("ServiceException");
         if service_exc_count >= 2 {
             *scores.entry(CodeCategory::ServiceExceptionHandler).or_insert(0.0) += (service_exc_count as f64 * 0.8).min(8.0);
             evidence.push(format!("ServiceException handler ({} errors)", service_exc_count));
@@ -788,105 +1254,105 @@ impl BehaviorAnalyzer {
         // Iteration 8: Additional error types
 
         // AbortError (88 occurrences!)
-        let abort_error_count = self.code.matches("AbortError").count();
+        let abort_error_count = self.count("AbortError");
         if abort_error_count >= 2 {
             *scores.entry(CodeCategory::AbortErrorHandler).or_insert(0.0) += (abort_error_count as f64 * 0.8).min(8.0);
             evidence.push(format!("AbortError handler ({} errors)", abort_error_count));
         }
 
         // SyntaxError (82 occurrences!)
-        let syntax_error_count = self.code.matches("SyntaxError").count();
+        let syntax_error_count = self.count("SyntaxError");
         if syntax_error_count >= 2 {
             *scores.entry(CodeCategory::SyntaxErrorHandler).or_insert(0.0) += (syntax_error_count as f64 * 0.8).min(8.0);
             evidence.push(format!("SyntaxError handler ({} errors)", syntax_error_count));
         }
 
         // TimeoutError (76 occurrences!)
-        let timeout_error_count = self.code.matches("TimeoutError").count();
+        let timeout_error_count = self.count("TimeoutError");
         if timeout_error_count >= 2 {
             *scores.entry(CodeCategory::TimeoutErrorHandler).or_insert(0.0) += (timeout_error_count as f64 * 0.8).min(8.0);
             evidence.push(format!("TimeoutError handler ({} errors)", timeout_error_count));
         }
 
         // UnknownError (62 occurrences!)
-        let unknown_error_count = self.code.matches("UnknownError").count();
+        let unknown_error_count = self.count("UnknownError");
         if unknown_error_count >= 2 {
             *scores.entry(CodeCategory::UnknownErrorHandler).or_insert(0.0) += (unknown_error_count as f64 * 0.7).min(7.0);
             evidence.push(format!("UnknownError handler ({} errors)", unknown_error_count));
         }
 
         // QueryError (62 occurrences!)
-        let query_error_count = self.code.matches("QueryError").count();
+        let query_error_count = self.count("QueryError");
         if query_error_count >= 2 {
             *scores.entry(CodeCategory::QueryErrorHandler).or_insert(0.0) += (query_error_count as f64 * 0.7).min(7.0);
             evidence.push(format!("QueryError handler ({} errors)", query_error_count));
         }
 
         // ReferenceError (59 occurrences!)
-        let ref_error_count = self.code.matches("ReferenceError").count();
+        let ref_error_count = self.count("ReferenceError");
         if ref_error_count >= 2 {
             *scores.entry(CodeCategory::ReferenceErrorHandler).or_insert(0.0) += (ref_error_count as f64 * 0.7).min(7.0);
             evidence.push(format!("ReferenceError handler ({} errors)", ref_error_count));
         }
 
         // ParseError (58 occurrences!)
-        let parse_error_count = self.code.matches("ParseError").count();
+        let parse_error_count = self.count("ParseError");
         if parse_error_count >= 2 {
             *scores.entry(CodeCategory::ParseErrorHandler).or_insert(0.0) += (parse_error_count as f64 * 0.7).min(7.0);
             evidence.push(format!("ParseError handler ({} errors)", parse_error_count));
         }
 
         // ResponseError (54 occurrences!)
-        let response_error_count = self.code.matches("ResponseError").count();
+        let response_error_count = self.count("ResponseError");
         if response_error_count >= 2 {
             *scores.entry(CodeCategory::ResponseErrorHandler).or_insert(0.0) += (response_error_count as f64 * 0.7).min(7.0);
             evidence.push(format!("ResponseError handler ({} errors)", response_error_count));
         }
 
         // RequestError (54 occurrences!)
-        let request_error_count = self.code.matches("RequestError").count();
+        let request_error_count = self.count("RequestError");
         if request_error_count >= 2 {
             *scores.entry(CodeCategory::RequestErrorHandler).or_insert(0.0) += (request_error_count as f64 * 0.7).min(7.0);
             evidence.push(format!("RequestError handler ({} errors)", request_error_count));
         }
 
         // InternalError (54 occurrences!)
-        let internal_error_count = self.code.matches("InternalError").count();
+        let internal_error_count = self.count("InternalError");
         if internal_error_count >= 2 {
             *scores.entry(CodeCategory::InternalErrorHandler).or_insert(0.0) += (internal_error_count as f64 * 0.7).min(7.0);
             evidence.push(format!("InternalError handler ({} errors)", internal_error_count));
         }
 
         // TokenException (48 occurrences!)
-        let token_exc_count = self.code.matches("TokenException").count();
+        let token_exc_count = self.count("TokenException");
         if token_exc_count >= 2 {
             *scores.entry(CodeCategory::TokenExceptionHandler).or_insert(0.0) += (token_exc_count as f64 * 0.7).min(7.0);
             evidence.push(format!("TokenException handler ({} errors)", token_exc_count));
         }
 
         // ServerException (44 occurrences!)
-        let server_exc_count = self.code.matches("ServerException").count();
+        let server_exc_count = self.count("ServerException");
         if server_exc_count >= 2 {
             *scores.entry(CodeCategory::ServerExceptionHandler).or_insert(0.0) += (server_exc_count as f64 * 0.7).min(7.0);
             evidence.push(format!("ServerException handler ({} errors)", server_exc_count));
         }
 
         // AxiosError (44 occurrences!)
-        let axios_error_count = self.code.matches("AxiosError").count();
+        let axios_error_count = self.count("AxiosError");
         if axios_error_count >= 2 {
             *scores.entry(CodeCategory::AxiosErrorHandler).or_insert(0.0) += (axios_error_count as f64 * 0.7).min(7.0);
             evidence.push(format!("AxiosError handler ({} errors)", axios_error_count));
         }
 
         // ParserError (42 occurrences!)
-        let parser_error_count = self.code.matches("ParserError").count();
+        let parser_error_count = self.count("ParserError");
         if parser_error_count >= 2 {
             *scores.entry(CodeCategory::ParserErrorHandler).or_insert(0.0) += (parser_error_count as f64 * 0.7).min(7.0);
             evidence.push(format!("ParserError handler ({} errors)", parser_error_count));
         }
 
         // AuthError (42 occurrences!)
-        let auth_error_count = self.code.matches("AuthError").count();
+        let auth_error_count = self.count("AuthError");
         if auth_error_count >= 2 {
             *scores.entry(CodeCategory::AuthErrorHandler).or_insert(0.0) += (auth_error_count as f64 * 0.7).min(7.0);
             evidence.push(format!("AuthError handler ({} errors)", auth_error_count));
@@ -897,11 +1363,11 @@ impl BehaviorAnalyzer {
     /// These patterns prioritize code content over misleading source map names
     fn analyze_content_based_categories(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
         // 1. Elliptic Curve Cryptography (HmacDRBG, EC, KeyPair, Signature)
-        let has_hmac_drbg = self.code.contains("HmacDRBG");
-        let has_keypair = self.code.contains("KeyPair") || self.code.contains("keyPair");
-        let has_ec = self.code.matches("function EC(").count() > 0 || self.code.contains("new EC(");
-        let has_signature = self.code.contains("Signature");
-        let has_curve = self.code.contains(".curve") && self.code.contains("precompute");
+        let has_hmac_drbg = self.contains("HmacDRBG");
+        let has_keypair = self.contains("KeyPair") || self.contains("keyPair");
+        let has_ec = self.count("function EC(") > 0 || self.contains("new EC(");
+        let has_signature = self.contains("Signature");
+        let has_curve = self.contains(".curve") && self.contains("precompute");
 
         if (has_hmac_drbg && has_keypair) || (has_ec && has_curve) {
             let mut crypto_score = 10.0;
@@ -918,10 +1384,10 @@ impl BehaviorAnalyzer {
         }
 
         // 2. Node Error Factory (createErrorType, NodeError, codes[])
-        let has_create_error_type = self.code.contains("createErrorType");
-        let has_node_error = self.code.contains("NodeError");
-        let has_codes_array = self.code.contains("codes[");
-        let has_get_message = self.code.contains("getMessage");
+        let has_create_error_type = self.contains("createErrorType");
+        let has_node_error = self.contains("NodeError");
+        let has_codes_array = self.contains("codes[");
+        let has_get_message = self.contains("getMessage");
 
         if has_create_error_type && (has_node_error || has_codes_array) {
             let mut error_factory_score = 10.0;
@@ -934,10 +1400,10 @@ impl BehaviorAnalyzer {
         }
 
         // 3. Bitwise Crypto Operations (ushrn, bitLength, nh)
-        let has_ushrn = self.code.contains("ushrn");
-        let has_bit_length = self.code.contains("bitLength");
-        let has_nh = self.code.contains(".nh") && self.code.contains("result");
-        let has_bit_ops = self.code.contains("<<") || self.code.contains(">>");
+        let has_ushrn = self.contains("ushrn");
+        let has_bit_length = self.contains("bitLength");
+        let has_nh = self.contains(".nh") && self.contains("result");
+        let has_bit_ops = self.contains("<<") || self.contains(">>");
 
         if (has_ushrn && has_bit_length) || (has_nh && has_bit_ops) {
             *scores.entry(CodeCategory::BitwiseCryptoOps).or_insert(0.0) += 10.0;
@@ -945,11 +1411,11 @@ impl BehaviorAnalyzer {
         }
 
         // 4. JavaScript Syntax Highlighter (JSX, className, keyword highlighting)
-        let has_jsx_tags = self.code.contains("begin:\"<>\"") || self.code.contains("end:\"</>\"");
-        let has_classname = self.code.contains("className:\"number\"") || self.code.contains("className:\"string\"");
-        let has_keyword_literal = self.code.contains("keyword:") && self.code.contains("literal:");
-        let has_builtin = self.code.contains("built_in:");
-        let has_uri_encode = self.code.contains("decodeURI") && self.code.contains("encodeURI");
+        let has_jsx_tags = self.contains("begin:\"<>\"") || self.contains("end:\"</>\"");
+        let has_classname = self.contains("className:\"number\"") || self.contains("className:\"string\"");
+        let has_keyword_literal = self.contains("keyword:") && self.contains("literal:");
+        let has_builtin = self.contains("built_in:");
+        let has_uri_encode = self.contains("decodeURI") && self.contains("encodeURI");
 
         if (has_jsx_tags && has_classname) || (has_keyword_literal && has_builtin) || has_uri_encode {
             *scores.entry(CodeCategory::JavaScriptSyntaxHighlighter).or_insert(0.0) += 10.0;
@@ -957,11 +1423,11 @@ impl BehaviorAnalyzer {
         }
 
         // 5. React DevTools Profiler (__REACT_DEVTOOLS_GLOBAL_HOOK__, performance.now)
-        let has_devtools_hook = self.code.contains("__REACT_DEVTOOLS_GLOBAL_HOOK__");
-        let has_get_internal_ranges = self.code.contains("getInternalModuleRanges");
-        let has_display_name_fiber = self.code.contains("getDisplayNameForFiber");
-        let has_is_profiling = self.code.contains("getIsProfiling");
-        let has_profiler_version = self.code.contains("--profiler-v") || self.code.contains("--react-version");
+        let has_devtools_hook = self.contains("__REACT_DEVTOOLS_GLOBAL_HOOK__");
+        let has_get_internal_ranges = self.contains("getInternalModuleRanges");
+        let has_display_name_fiber = self.contains("getDisplayNameForFiber");
+        let has_is_profiling = self.contains("getIsProfiling");
+        let has_profiler_version = self.contains("--profiler-v") || self.contains("--react-version");
 
         if has_devtools_hook || (has_display_name_fiber && has_is_profiling) || has_profiler_version {
             let mut devtools_score = 10.0;
@@ -974,18 +1440,18 @@ impl BehaviorAnalyzer {
         }
 
         // 6. API Error Handler (API-specific error patterns)
-        let api_error_patterns = self.code.matches("api_error").count() +
-                                 self.code.matches("ApiError").count() +
-                                 self.code.matches("API_ERROR").count();
+        let api_error_patterns = self.count("api_error") +
+                                 self.count("ApiError") +
+                                 self.count("API_ERROR");
         if api_error_patterns >= 3 {
             *scores.entry(CodeCategory::APIErrorHandler).or_insert(0.0) += 8.0;
             evidence.push(format!("API Error Handler ({} patterns)", api_error_patterns));
         }
 
         // 7. Error Recovery System (recovery strategies, retry logic)
-        let has_recovery = self.code.contains("recovery") || self.code.contains("recover");
-        let has_retry = self.code.contains("retry") || self.code.contains("Retry");
-        let has_fallback = self.code.contains("fallback") || self.code.contains("Fallback");
+        let has_recovery = self.contains("recovery") || self.contains("recover");
+        let has_retry = self.contains("retry") || self.contains("Retry");
+        let has_fallback = self.contains("fallback") || self.contains("Fallback");
 
         if (has_recovery && has_retry) || (has_recovery && has_fallback) {
             *scores.entry(CodeCategory::ErrorRecoverySystem).or_insert(0.0) += 8.0;
@@ -993,17 +1459,17 @@ impl BehaviorAnalyzer {
         }
 
         // 8. Fallback Error Handler
-        let fallback_count = self.code.matches("fallback").count();
+        let fallback_count = self.count("fallback");
         if fallback_count >= 5 {
             *scores.entry(CodeCategory::FallbackErrorHandler).or_insert(0.0) += 8.0;
             evidence.push(format!("Fallback Error Handler ({} refs)", fallback_count));
         }
 
         // 9. Promise Error Handler (unhandledRejection, promise rejection)
-        let has_unhandled_rejection = self.code.contains("unhandledRejection");
-        let has_promise_reject = self.code.contains("PromiseRejection") ||
-                                self.code.contains("promise.reject");
-        let promise_error_count = self.code.matches("promiseError").count();
+        let has_unhandled_rejection = self.contains("unhandledRejection");
+        let has_promise_reject = self.contains("PromiseRejection") ||
+                                self.contains("promise.reject");
+        let promise_error_count = self.count("promiseError");
 
         if has_unhandled_rejection || has_promise_reject || promise_error_count >= 3 {
             *scores.entry(CodeCategory::PromiseErrorHandler).or_insert(0.0) += 8.0;
@@ -1011,10 +1477,10 @@ impl BehaviorAnalyzer {
         }
 
         // 10. Regex Engine (regex compilation and execution)
-        let has_regex_compile = self.code.contains("RegExp(") || self.code.contains("new RegExp");
-        let has_regex_test = self.code.contains(".test(") && has_regex_compile;
-        let has_regex_exec = self.code.contains(".exec(") && has_regex_compile;
-        let regex_count = self.code.matches("RegExp").count();
+        let has_regex_compile = self.contains("RegExp(") || self.contains("new RegExp");
+        let has_regex_test = self.contains(".test(") && has_regex_compile;
+        let has_regex_exec = self.contains(".exec(") && has_regex_compile;
+        let regex_count = self.count("RegExp");
 
         if (has_regex_test || has_regex_exec) && regex_count >= 3 {
             *scores.entry(CodeCategory::RegexEngine).or_insert(0.0) += 8.0;
@@ -1022,9 +1488,9 @@ impl BehaviorAnalyzer {
         }
 
         // 11. Timestamp Manager (timestamp creation and formatting)
-        let has_timestamp = self.code.matches("timestamp").count();
-        let has_to_iso = self.code.contains("toISOString");
-        let has_date_now = self.code.contains("Date.now");
+        let has_timestamp = self.count("timestamp");
+        let has_to_iso = self.contains("toISOString");
+        let has_date_now = self.contains("Date.now");
 
         if has_timestamp >= 5 || (has_to_iso && has_date_now) {
             *scores.entry(CodeCategory::TimestampManager).or_insert(0.0) += 7.0;
@@ -1032,10 +1498,10 @@ impl BehaviorAnalyzer {
         }
 
         // 12. Sync File I/O (sync file operations)
-        let sync_ops = self.code.matches("Sync").count();
-        let has_fs_sync = self.code.contains("readFileSync") ||
-                         self.code.contains("writeFileSync") ||
-                         self.code.contains("existsSync");
+        let sync_ops = self.count("Sync");
+        let has_fs_sync = self.contains("readFileSync") ||
+                         self.contains("writeFileSync") ||
+                         self.contains("existsSync");
 
         if has_fs_sync && sync_ops >= 3 {
             *scores.entry(CodeCategory::SyncFileIO).or_insert(0.0) += 8.0;
@@ -1043,9 +1509,9 @@ impl BehaviorAnalyzer {
         }
 
         // 13. Image Processor (image handling)
-        let has_image = self.code.matches("image").count() + self.code.matches("Image").count();
-        let has_canvas = self.code.contains("canvas") || self.code.contains("Canvas");
-        let has_png_jpg = self.code.contains("png") || self.code.contains("jpg") || self.code.contains("jpeg");
+        let has_image = self.count("image") + self.count("Image");
+        let has_canvas = self.contains("canvas") || self.contains("Canvas");
+        let has_png_jpg = self.contains("png") || self.contains("jpg") || self.contains("jpeg");
 
         if has_image >= 5 || (has_canvas && has_png_jpg) {
             *scores.entry(CodeCategory::ImageProcessor).or_insert(0.0) += 7.0;
@@ -1055,11 +1521,11 @@ impl BehaviorAnalyzer {
         // ITERATION 14: Additional obfuscated utilities!
 
         // 14. Date-fns Library (date manipulation with locale support)
-        let has_week_starts_on = self.code.contains("weekStartsOn");
-        let has_get_full_year = self.code.contains("getFullYear");
-        let has_date_utc = self.code.contains("Date.UTC");
-        let has_locale_options = self.code.contains("locale?.options");
-        let has_set_hours_zero = self.code.contains("setHours(0,0,0,0)");
+        let has_week_starts_on = self.contains("weekStartsOn");
+        let has_get_full_year = self.contains("getFullYear");
+        let has_date_utc = self.contains("Date.UTC");
+        let has_locale_options = self.contains("locale?.options");
+        let has_set_hours_zero = self.contains("setHours(0,0,0,0)");
 
         if (has_week_starts_on && has_get_full_year) || (has_date_utc && has_set_hours_zero) || has_locale_options {
             *scores.entry(CodeCategory::DateFnsLibrary).or_insert(0.0) += 10.0;
@@ -1067,11 +1533,11 @@ impl BehaviorAnalyzer {
         }
 
         // 15. Debounce/Throttle (Lodash-style timer control)
-        let has_leading = self.code.contains("leading");
-        let has_trailing = self.code.contains("trailing");
-        let has_max_wait = self.code.contains("maxWait");
-        let has_clear_timeout = self.code.contains("clearTimeout");
-        let debounce_count = self.code.matches("debounce").count() + self.code.matches("throttle").count();
+        let has_leading = self.contains("leading");
+        let has_trailing = self.contains("trailing");
+        let has_max_wait = self.contains("maxWait");
+        let has_clear_timeout = self.contains("clearTimeout");
+        let debounce_count = self.count("debounce") + self.count("throttle");
 
         if (has_leading && has_trailing && has_max_wait) || debounce_count >= 3 {
             *scores.entry(CodeCategory::DebounceThrottle).or_insert(0.0) += 10.0;
@@ -1079,10 +1545,10 @@ impl BehaviorAnalyzer {
         }
 
         // 16. JSON Tokenizer (brace/bracket matching for parsing)
-        let has_type_brace = self.code.contains("type:\"brace\"") || self.code.contains("type:'brace'");
-        let has_type_paren = self.code.contains("type:\"paren\"") || self.code.contains("type:'paren'");
-        let has_json_parse = self.code.contains("JSON.parse");
-        let bracket_count = self.code.matches("{type:").count();
+        let has_type_brace = self.contains("type:\"brace\"") || self.contains("type:'brace'");
+        let has_type_paren = self.contains("type:\"paren\"") || self.contains("type:'paren'");
+        let has_json_parse = self.contains("JSON.parse");
+        let bracket_count = self.count("{type:");
 
         if (has_type_brace && has_type_paren) || (bracket_count >= 3 && has_json_parse) {
             *scores.entry(CodeCategory::JSONTokenizer).or_insert(0.0) += 10.0;
@@ -1090,11 +1556,11 @@ impl BehaviorAnalyzer {
         }
 
         // 17. Startup Profiler (performance timing and reporting)
-        let has_startup_time = self.code.contains("startup") && self.code.contains("startTime");
-        let has_perf_marks = self.code.contains("getEntriesByType(\"mark\")") ||
-                            self.code.contains("getEntriesByType('mark')");
-        let has_profiling = self.code.contains("profiling") || self.code.contains("Performance");
-        let has_startup_perf = self.code.contains("startup-perf");
+        let has_startup_time = self.contains("startup") && self.contains("startTime");
+        let has_perf_marks = self.contains("getEntriesByType(\"mark\")") ||
+                            self.contains("getEntriesByType('mark')");
+        let has_profiling = self.contains("profiling") || self.contains("Performance");
+        let has_startup_perf = self.contains("startup-perf");
 
         if has_startup_perf || (has_startup_time && has_perf_marks) || (has_perf_marks && has_profiling) {
             let mut profiler_score = 10.0;
@@ -1107,12 +1573,12 @@ impl BehaviorAnalyzer {
         }
 
         // 18. Object Inspector (property introspection and serialization)
-        let has_get_own_property = self.code.contains("getOwnPropertyDescriptor") ||
-                                  self.code.contains("getOwnPropertyNames");
-        let has_proto_check = self.code.contains("__proto__");
-        let has_constructor_name = self.code.contains("constructor?.name") ||
-                                   self.code.contains("constructor.name");
-        let has_to_iso_string = self.code.contains("toISOString()");
+        let has_get_own_property = self.contains("getOwnPropertyDescriptor") ||
+                                  self.contains("getOwnPropertyNames");
+        let has_proto_check = self.contains("__proto__");
+        let has_constructor_name = self.contains("constructor?.name") ||
+                                   self.contains("constructor.name");
+        let has_to_iso_string = self.contains("toISOString()");
 
         if (has_get_own_property && has_proto_check) ||
            (has_constructor_name && has_to_iso_string && has_proto_check) {
@@ -1121,12 +1587,12 @@ impl BehaviorAnalyzer {
         }
 
         // 19. Elm Syntax Highlighter (Elm language highlighting)
-        let has_infix_keywords = self.code.contains("infix infixl infixr") ||
-                                self.code.contains("infixl") ||
-                                self.code.contains("infixr");
-        let has_port_keyword = self.code.contains("port") && self.code.contains("keywords");
-        let has_illegal_semicolon = self.code.contains("illegal:/;/") ||
-                                    self.code.contains("illegal: /;/");
+        let has_infix_keywords = self.contains("infix infixl infixr") ||
+                                self.contains("infixl") ||
+                                self.contains("infixr");
+        let has_port_keyword = self.contains("port") && self.contains("keywords");
+        let has_illegal_semicolon = self.contains("illegal:/;/") ||
+                                    self.contains("illegal: /;/");
 
         if (has_infix_keywords && has_port_keyword) || has_illegal_semicolon {
             let mut elm_score = 10.0;
@@ -1143,11 +1609,11 @@ impl BehaviorAnalyzer {
         }
 
         // 20. Lodash Type Checker (type introspection with [object Type] tags)
-        let object_type_count = self.code.matches("[object ").count();
-        let has_object_array = self.code.contains("[object Array]");
-        let has_object_function = self.code.contains("[object Function]");
-        let has_object_regexp = self.code.contains("[object RegExp]");
-        let has_max_safe_int = self.code.contains("9007199254740991");
+        let object_type_count = self.count("[object ");
+        let has_object_array = self.contains("[object Array]");
+        let has_object_function = self.contains("[object Function]");
+        let has_object_regexp = self.contains("[object RegExp]");
+        let has_max_safe_int = self.contains("9007199254740991");
 
         if object_type_count >= 5 || (has_object_array && has_object_function) || has_max_safe_int {
             *scores.entry(CodeCategory::LodashTypeChecker).or_insert(0.0) += 10.0;
@@ -1155,11 +1621,11 @@ impl BehaviorAnalyzer {
         }
 
         // 21. RxJS Operators (.subscribe, createOperatorSubscriber, Observable)
-        let has_subscribe = self.code.contains(".subscribe(") || self.code.contains(".unsubscribe()");
-        let has_observable = self.code.contains("Observable") || self.code.contains("Subject");
-        let has_operator = self.code.contains("createOperatorSubscriber") ||
-                           self.code.contains(".operate(function");
-        let subscribe_count = self.code.matches("subscribe").count();
+        let has_subscribe = self.contains(".subscribe(") || self.contains(".unsubscribe()");
+        let has_observable = self.contains("Observable") || self.contains("Subject");
+        let has_operator = self.contains("createOperatorSubscriber") ||
+                           self.contains(".operate(function");
+        let subscribe_count = self.count("subscribe");
 
         if (has_subscribe && has_observable) || subscribe_count >= 3 {
             let mut rxjs_score = 10.0;
@@ -1176,12 +1642,12 @@ impl BehaviorAnalyzer {
         }
 
         // 22. OpenTelemetry Encoding (hrTimeToNanos, hexToBinary, encodeAsLongBits)
-        let has_hex_to_binary = self.code.contains("hexToBinary");
-        let has_hr_time = self.code.contains("hrTimeToNanos") || self.code.contains("encodeAsLongBits");
-        let has_instrumentation = self.code.contains("createInstrumentationScope") ||
-                                  self.code.contains("createResource");
-        let has_to_any_value = self.code.contains("toAnyValue") || self.code.contains("toAttributes");
-        let has_bigint_encoding = self.code.contains("BigInt.asUintN") && self.code.contains("low:") && self.code.contains("high:");
+        let has_hex_to_binary = self.contains("hexToBinary");
+        let has_hr_time = self.contains("hrTimeToNanos") || self.contains("encodeAsLongBits");
+        let has_instrumentation = self.contains("createInstrumentationScope") ||
+                                  self.contains("createResource");
+        let has_to_any_value = self.contains("toAnyValue") || self.contains("toAttributes");
+        let has_bigint_encoding = self.contains("BigInt.asUintN") && self.contains("low:") && self.contains("high:");
 
         if (has_hex_to_binary && has_hr_time) || has_instrumentation || (has_bigint_encoding && has_to_any_value) {
             let mut otel_score = 10.0;
@@ -1198,11 +1664,11 @@ impl BehaviorAnalyzer {
         }
 
         // 23. Zlib Compression (Z_ constants, deflate/inflate)
-        let has_z_constants = self.code.contains("Z_MIN_WINDOWBITS") ||
-                              self.code.contains("Z_DEFAULT_CHUNK") ||
-                              self.code.contains("Z_MAX_LEVEL");
-        let has_deflate = self.code.contains("deflate") || self.code.contains("inflate");
-        let has_gzip = self.code.contains("gzip") || self.code.contains("gunzip");
+        let has_z_constants = self.contains("Z_MIN_WINDOWBITS") ||
+                              self.contains("Z_DEFAULT_CHUNK") ||
+                              self.contains("Z_MAX_LEVEL");
+        let has_deflate = self.contains("deflate") || self.contains("inflate");
+        let has_gzip = self.contains("gzip") || self.contains("gunzip");
         // PRECISION FIX: Only count ACTUAL zlib constants, not just "Z_" anywhere
         let zlib_specific_constants = [
             "Z_NO_FLUSH", "Z_PARTIAL_FLUSH", "Z_SYNC_FLUSH", "Z_FULL_FLUSH",
@@ -1212,7 +1678,7 @@ impl BehaviorAnalyzer {
             "Z_FILTERED", "Z_HUFFMAN_ONLY", "Z_DEFLATED"
         ];
         let z_count = zlib_specific_constants.iter()
-            .filter(|c| self.code.contains(*c))
+            .filter(|c| self.contains(*c))
             .count();
 
         if has_z_constants || z_count >= 5 {
@@ -1230,13 +1696,13 @@ impl BehaviorAnalyzer {
         }
 
         // 24. Installation Detection (Homebrew, winget, npm config)
-        let has_homebrew = self.code.contains("Homebrew") || self.code.contains("Caskroom");
-        let has_winget = self.code.contains("winget") || self.code.contains("Microsoft/WinGet");
-        let has_npm_prefix = self.code.contains("npm config get prefix");
-        let has_exec_path = self.code.contains("process.execPath");
-        let has_install_paths = self.code.contains("node_modules") ||
-                                self.code.contains("/opt/homebrew/") ||
-                                self.code.contains(".nvm/versions");
+        let has_homebrew = self.contains("Homebrew") || self.contains("Caskroom");
+        let has_winget = self.contains("winget") || self.contains("Microsoft/WinGet");
+        let has_npm_prefix = self.contains("npm config get prefix");
+        let has_exec_path = self.contains("process.execPath");
+        let has_install_paths = self.contains("node_modules") ||
+                                self.contains("/opt/homebrew/") ||
+                                self.contains(".nvm/versions");
 
         if (has_homebrew && has_exec_path) || (has_winget && has_exec_path) || has_npm_prefix {
             let mut install_score = 10.0;
@@ -1253,13 +1719,13 @@ impl BehaviorAnalyzer {
         }
 
         // 25. Anthropic API Client (api.anthropic.com, CLAUDE_CODE_USE_BEDROCK)
-        let has_api_anthropic = self.code.contains("api.anthropic.com");
-        let has_bedrock = self.code.contains("CLAUDE_CODE_USE_BEDROCK") ||
-                          self.code.contains("CLAUDE_CODE_USE_VERTEX") ||
-                          self.code.contains("CLAUDE_CODE_USE_FOUNDRY");
-        let has_session_logs = self.code.contains("Error fetching session logs") ||
-                               self.code.contains("session_get_fail_status");
-        let has_connectivity = self.code.contains("isConnected") && self.code.contains("EHOSTUNREACH");
+        let has_api_anthropic = self.contains("api.anthropic.com");
+        let has_bedrock = self.contains("CLAUDE_CODE_USE_BEDROCK") ||
+                          self.contains("CLAUDE_CODE_USE_VERTEX") ||
+                          self.contains("CLAUDE_CODE_USE_FOUNDRY");
+        let has_session_logs = self.contains("Error fetching session logs") ||
+                               self.contains("session_get_fail_status");
+        let has_connectivity = self.contains("isConnected") && self.contains("EHOSTUNREACH");
 
         if has_api_anthropic || (has_bedrock && has_connectivity) {
             let mut api_score = 10.0;
@@ -1276,18 +1742,18 @@ impl BehaviorAnalyzer {
         }
 
         // 26. Lodash Core Library (heavy typeof checks, Object.keys, type coercion)
-        let typeof_count = self.code.matches("typeof").count();
-        let has_object_keys = self.code.contains("Object.keys") ||
-                              self.code.contains("Object.getOwnPropertySymbols");
-        let has_value_of = self.code.contains("T.valueOf==") ||
-                           self.code.contains("$.valueOf()") ||
-                           self.code.contains("S.valueOf");
-        let has_type_coercion = self.code.contains("T===0?T:0") ||
-                                self.code.contains("S===S?") ||
-                                self.code.contains("T===T?T:0");
-        let minified_function_count = self.code.matches("function").count();
-        let single_char_params = self.code.matches("(T,S)").count() +
-                                 self.code.matches("(T)").count();
+        let typeof_count = self.count("typeof");
+        let has_object_keys = self.contains("Object.keys") ||
+                              self.contains("Object.getOwnPropertySymbols");
+        let has_value_of = self.contains("T.valueOf==") ||
+                           self.contains("$.valueOf()") ||
+                           self.contains("S.valueOf");
+        let has_type_coercion = self.contains("T===0?T:0") ||
+                                self.contains("S===S?") ||
+                                self.contains("T===T?T:0");
+        let minified_function_count = self.count("function");
+        let single_char_params = self.count("(T,S)") +
+                                 self.count("(T)");
 
         if (typeof_count >= 5 && has_object_keys && has_type_coercion) ||
            (minified_function_count >= 10 && single_char_params >= 5) {
@@ -1306,58 +1772,58 @@ impl BehaviorAnalyzer {
 
         // 27. Crypto Library Wrappers (Iteration 24: browserify-crypto, ASN.1, elliptic, hash libs)
         // These are thin wrappers that re-export crypto functions
-        let has_crypto_require = self.code.contains("require(\"crypto\")");
-        let has_crypto_exports = self.code.contains("createCipher") ||
-                                 self.code.contains("createCipheriv") ||
-                                 self.code.contains("createHash") ||
-                                 self.code.contains("createHmac") ||
-                                 self.code.contains("createSign") ||
-                                 self.code.contains("createVerify") ||
-                                 self.code.contains("DiffieHellman") ||
-                                 self.code.contains("createECDH");
+        let has_crypto_require = self.contains("require(\"crypto\")");
+        let has_crypto_exports = self.contains("createCipher") ||
+                                 self.contains("createCipheriv") ||
+                                 self.contains("createHash") ||
+                                 self.contains("createHmac") ||
+                                 self.contains("createSign") ||
+                                 self.contains("createVerify") ||
+                                 self.contains("DiffieHellman") ||
+                                 self.contains("createECDH");
 
         // Browserify crypto wrappers
-        let has_browserify_crypto = (self.code.contains("browserify") ||
-                                     self.code.contains("Browserify")) &&
-                                    (self.code.contains("Cipher") ||
-                                     self.code.contains("Hash") ||
-                                     self.code.contains("Sign"));
+        let has_browserify_crypto = (self.contains("browserify") ||
+                                     self.contains("Browserify")) &&
+                                    (self.contains("Cipher") ||
+                                     self.contains("Hash") ||
+                                     self.contains("Sign"));
 
         // ASN.1 library structure (asn1.encoders, asn1.decoders, asn1.bignum)
-        let has_asn1 = self.code.contains("asn1.") &&
-                       (self.code.contains(".encoders") ||
-                        self.code.contains(".decoders") ||
-                        self.code.contains(".bignum") ||
-                        self.code.contains(".define"));
+        let has_asn1 = self.contains("asn1.") &&
+                       (self.contains(".encoders") ||
+                        self.contains(".decoders") ||
+                        self.contains(".bignum") ||
+                        self.contains(".define"));
 
         // Elliptic curve library entry point
-        let has_elliptic_lib = self.code.contains("elliptic.") &&
-                               (self.code.contains(".curve") ||
-                                self.code.contains(".ec") ||
-                                self.code.contains(".eddsa") ||
-                                self.code.contains(".utils"));
+        let has_elliptic_lib = self.contains("elliptic.") &&
+                               (self.contains(".curve") ||
+                                self.contains(".ec") ||
+                                self.contains(".eddsa") ||
+                                self.contains(".utils"));
 
         // Hash library entry point (hash.sha1, hash.sha256, hash.ripemd160)
-        let has_hash_lib = self.code.contains("hash.") &&
-                          (self.code.contains(".sha") ||
-                           self.code.contains(".ripemd") ||
-                           self.code.contains(".hmac"));
+        let has_hash_lib = self.contains("hash.") &&
+                          (self.contains(".sha") ||
+                           self.contains(".ripemd") ||
+                           self.contains(".hmac"));
 
         // OID mappings for crypto algorithms (2.16.840.1.101.3.4.1.X = aes-X)
-        let has_crypto_oids = self.code.contains("2.16.840.1.101") &&
-                             (self.code.contains("aes-") ||
-                              self.code.contains("des-") ||
-                              self.code.contains("rsa-"));
+        let has_crypto_oids = self.contains("2.16.840.1.101") &&
+                             (self.contains("aes-") ||
+                              self.contains("des-") ||
+                              self.contains("rsa-"));
 
         // Module re-export pattern: exports.X = crypto.X or exports.X = require_X()
-        let has_crypto_reexport = (self.code.contains("exports.") ||
-                                   self.code.contains("module.exports")) &&
-                                  (self.code.contains("Cipher") ||
-                                   self.code.contains("Hash") ||
-                                   self.code.contains("Hmac") ||
-                                   self.code.contains("Sign") ||
-                                   self.code.contains("Verify") ||
-                                   self.code.contains("ECDH"));
+        let has_crypto_reexport = (self.contains("exports.") ||
+                                   self.contains("module.exports")) &&
+                                  (self.contains("Cipher") ||
+                                   self.contains("Hash") ||
+                                   self.contains("Hmac") ||
+                                   self.contains("Sign") ||
+                                   self.contains("Verify") ||
+                                   self.contains("ECDH"));
 
         if (has_crypto_require && has_crypto_exports) ||
            has_browserify_crypto ||
@@ -1397,7 +1863,7 @@ impl BehaviorAnalyzer {
         let has_language_structure = language_indicators.iter()
             .any(|(p1, p2, p3)| {
                 [*p1, *p2, *p3].iter()
-                    .filter(|p| self.code.contains(**p))
+                    .filter(|p| self.contains(**p))
                     .count() >= 2
             });
 
@@ -1409,7 +1875,7 @@ impl BehaviorAnalyzer {
         ];
 
         let keyword_count = language_keywords.iter()
-            .filter(|k| self.code.contains(*k))
+            .filter(|k| self.contains(*k))
             .count();
 
         if has_language_structure && keyword_count >= 3 {
@@ -1421,11 +1887,11 @@ impl BehaviorAnalyzer {
         }
 
         // Detect common highlighter libraries
-        if self.code.contains("highlight.js") || self.code.contains("hljs") {
+        if self.contains("highlight.js") || self.contains("hljs") {
             *scores.entry(CodeCategory::SyntaxHighlighter).or_insert(0.0) += 2.0;
             evidence.push("highlight.js library".to_string());
         }
-        if self.code.contains("Prism") && self.code.contains("language-") {
+        if self.contains("Prism") && self.contains("language-") {
             *scores.entry(CodeCategory::SyntaxHighlighter).or_insert(0.0) += 2.0;
             evidence.push("Prism syntax highlighter".to_string());
         }
@@ -1471,7 +1937,7 @@ impl BehaviorAnalyzer {
         ];
 
         let matches = validation_errors.iter()
-            .filter(|e| self.code.contains(*e))
+            .filter(|e| self.contains(*e))
             .count();
 
         if matches >= 3 {
@@ -1480,7 +1946,7 @@ impl BehaviorAnalyzer {
         }
 
         // Detect zod/yup/joi patterns
-        if self.code.contains("z.object") || self.code.contains("yup.object") || self.code.contains("Joi.object") {
+        if self.contains("z.object") || self.contains("yup.object") || self.contains("Joi.object") {
             *scores.entry(CodeCategory::DataValidation).or_insert(0.0) += 1.0;
             evidence.push("Schema validator (zod/yup/joi)".to_string());
         }
@@ -1489,66 +1955,66 @@ impl BehaviorAnalyzer {
     /// Detect authentication flows - now detects DOMAIN-SPECIFIC patterns
     fn analyze_authentication(&self, scores: &mut HashMap<CodeCategory, f64>, evidence: &mut Vec<String>) {
         // AWS IAM/Cognito patterns
-        if (self.code.contains("AccessKeyId") || self.code.contains("SecretAccessKey")) &&
-           (self.code.contains("SessionToken") || self.code.contains("credential")) {
+        if (self.contains("AccessKeyId") || self.contains("SecretAccessKey")) &&
+           (self.contains("SessionToken") || self.contains("credential")) {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 2.0;
             evidence.push("AWS IAM Credentials (AccessKeyId + SecretAccessKey + SessionToken)".to_string());
         }
-        if self.code.contains("Cognito") && (self.code.contains("Identity") || self.code.contains("Pool")) {
+        if self.contains("Cognito") && (self.contains("Identity") || self.contains("Pool")) {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 1.5;
             evidence.push("AWS Cognito Identity".to_string());
         }
 
         // API Key authentication
-        if (self.code.contains("apiKey") || self.code.contains("api_key")) &&
-           (self.code.contains("header") || self.code.contains("Authorization")) {
+        if (self.contains("apiKey") || self.contains("api_key")) &&
+           (self.contains("header") || self.contains("Authorization")) {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 1.5;
             evidence.push("API Key Authentication".to_string());
         }
 
         // OAuth flows
-        if self.code.contains("OAuth") && self.code.contains("callback") {
+        if self.contains("OAuth") && self.contains("callback") {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 2.0;
             evidence.push("OAuth Callback Flow".to_string());
-        } else if self.code.contains("OAuth") {
+        } else if self.contains("OAuth") {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 1.2;
             evidence.push("OAuth Flow".to_string());
         }
 
         // JWT patterns
-        if self.code.contains("JWT") && self.code.contains("refresh") {
+        if self.contains("JWT") && self.contains("refresh") {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 1.8;
             evidence.push("JWT Refresh Token".to_string());
-        } else if self.code.contains("JWT") || self.code.contains("jsonwebtoken") {
+        } else if self.contains("JWT") || self.contains("jsonwebtoken") {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 1.2;
             evidence.push("JWT Token".to_string());
         }
 
         // Session-based auth
-        if self.code.contains("session") && self.code.contains("cookie") {
+        if self.contains("session") && self.contains("cookie") {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 1.5;
             evidence.push("Session Cookie Authentication".to_string());
         }
 
         // SAML
-        if self.code.contains("SAML") {
+        if self.contains("SAML") {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 1.5;
             evidence.push("SAML Authentication".to_string());
         }
 
         // MFA/2FA
-        if (self.code.contains("MFA") || self.code.contains("2FA") || self.code.contains("twoFactor")) &&
-           (self.code.contains("verify") || self.code.contains("code")) {
+        if (self.contains("MFA") || self.contains("2FA") || self.contains("twoFactor")) &&
+           (self.contains("verify") || self.contains("code")) {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 1.5;
             evidence.push("Multi-Factor Authentication".to_string());
         }
 
         // Social login patterns
-        if self.code.contains("google") && self.code.contains("sign") {
+        if self.contains("google") && self.contains("sign") {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 1.0;
             evidence.push("Google Sign-In".to_string());
         }
-        if self.code.contains("facebook") && self.code.contains("login") {
+        if self.contains("facebook") && self.contains("login") {
             *scores.entry(CodeCategory::AWSCredentialProvider).or_insert(0.0) += 1.0;
             evidence.push("Facebook Login".to_string());
         }
@@ -1578,12 +2044,12 @@ impl BehaviorAnalyzer {
         // Found: 87% false positive rate with old thresholds!
         // Files with incidental error throwing (React hooks, parsers) were misclassified
 
-        let try_count = self.code.matches("try{").count();
-        let catch_count = self.code.matches("catch(").count();
-        let throw_count = self.code.matches("throw ").count();
-        let error_new_count = self.code.matches("new Error(").count() +
-                              self.code.matches("new TypeError(").count() +
-                              self.code.matches("new RangeError(").count();
+        let try_count = self.count("try{");
+        let catch_count = self.count("catch(");
+        let throw_count = self.count("throw ");
+        let error_new_count = self.count("new Error(") +
+                              self.count("new TypeError(") +
+                              self.count("new RangeError(");
 
         // Signal 1: Substantial error handling (try/catch blocks)
         let has_error_handling = try_count >= 4 && catch_count >= 4;  // Raised from 2 to 4
@@ -1592,18 +2058,18 @@ impl BehaviorAnalyzer {
         let has_error_throwing = throw_count >= 8;  // Raised from 3 to 8
 
         // Signal 3: Error recovery patterns
-        let has_error_recovery = self.code.contains("retry") ||
-                                 self.code.contains("fallback") ||
-                                 self.code.contains("recover");
+        let has_error_recovery = self.contains("retry") ||
+                                 self.contains("fallback") ||
+                                 self.contains("recover");
 
         // Signal 4: Error construction (creating custom errors)
         let has_error_construction = error_new_count >= 3;
 
         // Signal 5: Error handler function names
-        let has_error_handler_names = self.code.contains("handleError") ||
-                                      self.code.contains("errorHandler") ||
-                                      self.code.contains("onError") ||
-                                      self.code.contains("catchError");
+        let has_error_handler_names = self.contains("handleError") ||
+                                      self.contains("errorHandler") ||
+                                      self.contains("onError") ||
+                                      self.contains("catchError");
 
         // Count how many signals are present
         let signal_count = [
@@ -1658,7 +2124,7 @@ impl BehaviorAnalyzer {
         let telemetry_patterns = ["tengu_", "track", "recordEvent", "analytics", "metric"];
 
         let matches = telemetry_patterns.iter()
-            .filter(|p| self.code.contains(*p))
+            .filter(|p| self.contains(*p))
             .count();
 
         if matches >= 2 {
@@ -1675,7 +2141,7 @@ impl BehaviorAnalyzer {
         ];
 
         let matches = permission_keywords.iter()
-            .filter(|k| self.code.contains(*k))
+            .filter(|k| self.contains(*k))
             .count();
 
         if matches >= 2 {
@@ -1692,7 +2158,7 @@ impl BehaviorAnalyzer {
         ];
 
         let matches = protocol_patterns.iter()
-            .filter(|p| self.code.contains(*p))
+            .filter(|p| self.contains(*p))
             .count();
 
         if matches >= 3 {
@@ -1730,7 +2196,7 @@ impl BehaviorAnalyzer {
                     "Google OAuth Provider".to_string()
                 } else if evidence.iter().any(|e| e.contains("Facebook Login")) {
                     "Facebook OAuth Provider".to_string()
-                } else if self.code.contains("login") && self.code.contains("rate") {
+                } else if self.contains("login") && self.contains("rate") {
                     "Login Rate Limiter".to_string()
                 } else {
                     "Auth Flow Controller".to_string()
@@ -1788,7 +2254,7 @@ impl BehaviorAnalyzer {
                     "Password Strength Validator".to_string()
                 } else if validation_targets.iter().any(|s| s == "phone") {
                     "Phone Number Validator".to_string()
-                } else if validation_targets.iter().any(|s| s == "schema") && self.code.contains("z.object") {
+                } else if validation_targets.iter().any(|s| s == "schema") && self.contains("z.object") {
                     "Zod Schema Validator".to_string()
                 } else if validation_targets.len() > 3 {
                     "Multi-Field Input Validator".to_string()
@@ -1799,15 +2265,15 @@ impl BehaviorAnalyzer {
                 }
             },
             CodeCategory::ErrorHandler => {
-                if self.code.contains("retry") && self.code.contains("exponential") {
+                if self.contains("retry") && self.contains("exponential") {
                     "Exponential Backoff Retry Handler".to_string()
-                } else if self.code.contains("retry") {
+                } else if self.contains("retry") {
                     "Error Recovery Handler".to_string()
-                } else if self.code.contains("fallback") {
+                } else if self.contains("fallback") {
                     "Fallback Error Handler".to_string()
-                } else if self.code.contains("API") || self.code.contains("api") {
+                } else if self.contains("API") || self.contains("api") {
                     "API Error Handler".to_string()
-                } else if self.code.contains("network") {
+                } else if self.contains("network") {
                     "Network Error Handler".to_string()
                 } else {
                     "Error Handler".to_string()
@@ -1816,128 +2282,128 @@ impl BehaviorAnalyzer {
             CodeCategory::TelemetryRecorder => {
                 if evidence.iter().any(|e| e.contains("tengu_")) {
                     "Telemetry Event Recorder".to_string()
-                } else if self.code.contains("metric") && self.code.contains("aggregate") {
+                } else if self.contains("metric") && self.contains("aggregate") {
                     "Metrics Aggregator".to_string()
-                } else if self.code.contains("track") && self.code.contains("user") {
+                } else if self.contains("track") && self.contains("user") {
                     "User Analytics Tracker".to_string()
-                } else if self.code.contains("performance") {
+                } else if self.contains("performance") {
                     "Performance Monitor".to_string()
                 } else {
                     "Analytics Tracker".to_string()
                 }
             },
             CodeCategory::PermissionControl => {
-                if self.code.contains("plan") || self.code.contains("Plan") {
+                if self.contains("plan") || self.contains("Plan") {
                     "Plan Mode Permission Enforcer".to_string()
-                } else if self.code.contains("RBAC") || self.code.contains("role") {
+                } else if self.contains("RBAC") || self.contains("role") {
                     "Role-Based Access Controller".to_string()
-                } else if self.code.contains("ACL") {
+                } else if self.contains("ACL") {
                     "Access Control List Manager".to_string()
-                } else if self.code.contains("file") && self.code.contains("path") {
+                } else if self.contains("file") && self.contains("path") {
                     "File Permission Checker".to_string()
                 } else {
                     "Access Control Manager".to_string()
                 }
             },
             CodeCategory::ProtocolHandler => {
-                if self.code.contains("Claude-") {
+                if self.contains("Claude-") {
                     "Claude Protocol Header Parser".to_string()
-                } else if self.code.contains("HTTP") || self.code.contains("http") {
+                } else if self.contains("HTTP") || self.contains("http") {
                     "HTTP Protocol Handler".to_string()
-                } else if self.code.contains("WebSocket") || self.code.contains("ws://") {
+                } else if self.contains("WebSocket") || self.contains("ws://") {
                     "WebSocket Protocol Handler".to_string()
-                } else if self.code.contains("gRPC") {
+                } else if self.contains("gRPC") {
                     "gRPC Protocol Handler".to_string()
                 } else {
                     "Protocol Handler".to_string()
                 }
             },
             CodeCategory::WorkflowOrchestration => {
-                if self.code.contains("step") && self.code.contains("pipeline") {
+                if self.contains("step") && self.contains("pipeline") {
                     "Pipeline Orchestrator".to_string()
-                } else if self.code.contains("saga") {
+                } else if self.contains("saga") {
                     "Saga Workflow Coordinator".to_string()
-                } else if self.code.contains("task") && self.code.contains("queue") {
+                } else if self.contains("task") && self.contains("queue") {
                     "Task Queue Orchestrator".to_string()
-                } else if self.code.contains("workflow") && self.code.contains("state") {
+                } else if self.contains("workflow") && self.contains("state") {
                     "Workflow State Coordinator".to_string()
                 } else {
                     "Workflow Orchestrator".to_string()
                 }
             },
             CodeCategory::ApiClient => {
-                if self.code.contains("fetch") && self.code.contains("retry") {
+                if self.contains("fetch") && self.contains("retry") {
                     "Resilient API Client".to_string()
-                } else if self.code.contains("GraphQL") {
+                } else if self.contains("GraphQL") {
                     "GraphQL API Client".to_string()
-                } else if self.code.contains("REST") || self.code.contains("RESTful") {
+                } else if self.contains("REST") || self.contains("RESTful") {
                     "REST API Client".to_string()
-                } else if self.code.contains("axios") {
+                } else if self.contains("axios") {
                     "Axios HTTP Client".to_string()
                 } else {
                     "API Client".to_string()
                 }
             },
             CodeCategory::MessageRouter => {
-                if self.code.contains("RabbitMQ") || self.code.contains("AMQP") {
+                if self.contains("RabbitMQ") || self.contains("AMQP") {
                     "RabbitMQ Message Router".to_string()
-                } else if self.code.contains("Kafka") {
+                } else if self.contains("Kafka") {
                     "Kafka Message Router".to_string()
-                } else if self.code.contains("topic") && self.code.contains("subscribe") {
+                } else if self.contains("topic") && self.contains("subscribe") {
                     "PubSub Message Router".to_string()
-                } else if self.code.contains("queue") {
+                } else if self.contains("queue") {
                     "Queue Message Router".to_string()
                 } else {
                     "Message Router".to_string()
                 }
             },
             CodeCategory::ResourceManagement => {
-                if self.code.contains("pool") && self.code.contains("connection") {
+                if self.contains("pool") && self.contains("connection") {
                     "Connection Pool Manager".to_string()
-                } else if self.code.contains("memory") && self.code.contains("limit") {
+                } else if self.contains("memory") && self.contains("limit") {
                     "Memory Resource Manager".to_string()
-                } else if self.code.contains("thread") || self.code.contains("worker") {
+                } else if self.contains("thread") || self.contains("worker") {
                     "Thread Pool Manager".to_string()
-                } else if self.code.contains("file") && self.code.contains("descriptor") {
+                } else if self.contains("file") && self.contains("descriptor") {
                     "File Descriptor Manager".to_string()
                 } else {
                     "Resource Manager".to_string()
                 }
             },
             CodeCategory::ConfigurationLoader => {
-                if self.code.contains(".env") || self.code.contains("dotenv") {
+                if self.contains(".env") || self.contains("dotenv") {
                     "Environment Config Loader".to_string()
-                } else if self.code.contains("yaml") || self.code.contains("YAML") {
+                } else if self.contains("yaml") || self.contains("YAML") {
                     "YAML Config Loader".to_string()
-                } else if self.code.contains("json") && self.code.contains("parse") {
+                } else if self.contains("json") && self.contains("parse") {
                     "JSON Config Loader".to_string()
-                } else if self.code.contains("secret") || self.code.contains("vault") {
+                } else if self.contains("secret") || self.contains("vault") {
                     "Secret Config Loader".to_string()
                 } else {
                     "Configuration Loader".to_string()
                 }
             },
             CodeCategory::LoggingSystem => {
-                if self.code.contains("winston") {
+                if self.contains("winston") {
                     "Winston Logger".to_string()
-                } else if self.code.contains("pino") {
+                } else if self.contains("pino") {
                     "Pino Logger".to_string()
-                } else if self.code.contains("structured") && self.code.contains("log") {
+                } else if self.contains("structured") && self.contains("log") {
                     "Structured Logger".to_string()
-                } else if self.code.contains("rotate") {
+                } else if self.contains("rotate") {
                     "Log Rotation Manager".to_string()
                 } else {
                     "Logging System".to_string()
                 }
             },
             CodeCategory::CacheManager => {
-                if self.code.contains("Redis") {
+                if self.contains("Redis") {
                     "Redis Cache Manager".to_string()
-                } else if self.code.contains("Memcached") {
+                } else if self.contains("Memcached") {
                     "Memcached Manager".to_string()
-                } else if self.code.contains("LRU") {
+                } else if self.contains("LRU") {
                     "LRU Cache Manager".to_string()
-                } else if self.code.contains("TTL") || self.code.contains("expire") {
+                } else if self.contains("TTL") || self.contains("expire") {
                     "TTL Cache Manager".to_string()
                 } else {
                     "Cache Manager".to_string()
@@ -1945,26 +2411,26 @@ impl BehaviorAnalyzer {
             },
             CodeCategory::SyntaxHighlighter => {
                 // Detect specific language
-                if self.code.contains("XQuery") || self.code.contains("XPath") {
+                if self.contains("XQuery") || self.contains("XPath") {
                     "XQuery Syntax Highlighter".to_string()
-                } else if self.code.contains("TypeScript") || self.code.contains("JavaScript") {
+                } else if self.contains("TypeScript") || self.contains("JavaScript") {
                     "TypeScript/JavaScript Highlighter".to_string()
-                } else if self.code.contains("Python") {
+                } else if self.contains("Python") {
                     "Python Syntax Highlighter".to_string()
-                } else if self.code.contains("SQL") {
+                } else if self.contains("SQL") {
                     "SQL Syntax Highlighter".to_string()
-                } else if self.code.contains("XML") || self.code.contains("HTML") {
+                } else if self.contains("XML") || self.contains("HTML") {
                     "XML/HTML Syntax Highlighter".to_string()
-                } else if self.code.contains("CSS") {
+                } else if self.contains("CSS") {
                     "CSS Syntax Highlighter".to_string()
                 } else {
                     "Syntax Highlighter".to_string()
                 }
             },
             CodeCategory::LanguageParser => {
-                if self.code.contains("AST") {
+                if self.contains("AST") {
                     "AST Parser".to_string()
-                } else if self.code.contains("lexer") {
+                } else if self.contains("lexer") {
                     "Lexical Analyzer".to_string()
                 } else {
                     "Language Parser".to_string()
@@ -2537,19 +3003,19 @@ impl BehaviorAnalyzer {
         let mut targets = Vec::new();
 
         // Check for specific field validations
-        if self.code.contains("email") {
+        if self.contains("email") {
             targets.push("email".to_string());
         }
-        if self.code.contains("url") || self.code.contains("URL") {
+        if self.contains("url") || self.contains("URL") {
             targets.push("url".to_string());
         }
-        if self.code.contains("datetime") || self.code.contains("date") {
+        if self.contains("datetime") || self.contains("date") {
             targets.push("datetime".to_string());
         }
-        if self.code.contains("password") {
+        if self.contains("password") {
             targets.push("password".to_string());
         }
-        if self.code.contains("phone") {
+        if self.contains("phone") {
             targets.push("phone".to_string());
         }
 
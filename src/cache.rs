@@ -1,12 +1,24 @@
-// Binary cache module using serde_json for serialization
+// Cache module: JSON tier for small human-inspectable entries, binary
+// tier (bincode + mmap) for large blobs where JSON deserialization time
+// dominates warm starts.
 #![allow(dead_code)]
 
-use anyhow::Result;
+use anyhow::{bail, Result};
 use serde::{de::DeserializeOwned, Serialize};
 use std::fs;
 use std::path::PathBuf;
 use std::time::{Duration, SystemTime};
 
+/// Magic bytes identifying a binary cache entry
+const BIN_MAGIC: &[u8; 4] = b"CVC\0";
+
+/// Bump to invalidate all existing binary cache entries when the layout
+/// of cached types changes incompatibly
+const BIN_FORMAT_VERSION: u32 = 1;
+
+/// Header length: magic + format version
+const BIN_HEADER_LEN: usize = 8;
+
 /// Get the cache directory
 pub fn get_cache_dir() -> PathBuf {
     dirs::cache_dir()
@@ -20,6 +32,11 @@ fn cache_path(key: &str) -> PathBuf {
     get_cache_dir().join(format!("{}.json", key))
 }
 
+/// Binary-tier cache key from a string
+fn cache_path_bin(key: &str) -> PathBuf {
+    get_cache_dir().join(format!("{}.bin", key))
+}
+
 /// Save data to cache
 pub fn cache_save<T: Serialize>(key: &str, data: &T) -> Result<()> {
     let cache_dir = get_cache_dir();
@@ -71,11 +88,119 @@ pub fn cache_load_fresh<T: DeserializeOwned>(key: &str, max_age: Duration) -> Re
     Ok(Some(data))
 }
 
-/// Clear a specific cache entry
+/// Save data to the binary tier. bincode encodes and decodes an order of
+/// magnitude faster than serde_json for the large metadata blobs
+/// (discovery snapshots, analysis results) that dominate warm starts.
+pub fn cache_save_bin<T: Serialize>(key: &str, data: &T) -> Result<()> {
+    let cache_dir = get_cache_dir();
+    fs::create_dir_all(&cache_dir)?;
+
+    let mut bytes = Vec::with_capacity(BIN_HEADER_LEN);
+    bytes.extend_from_slice(BIN_MAGIC);
+    bytes.extend_from_slice(&BIN_FORMAT_VERSION.to_le_bytes());
+    bincode::serialize_into(&mut bytes, data)?;
+
+    // Write-then-rename so a crashed run never leaves a torn entry
+    let path = cache_path_bin(key);
+    let tmp = path.with_extension("bin.tmp");
+    fs::write(&tmp, &bytes)?;
+    fs::rename(&tmp, &path)?;
+
+    Ok(())
+}
+
+/// Load data from the binary tier. Entries with a missing, foreign, or
+/// outdated header are treated as absent so stale formats self-invalidate.
+pub fn cache_load_bin<T: DeserializeOwned>(key: &str) -> Result<Option<T>> {
+    match cache_load_mmap(key)? {
+        Some(blob) => Ok(Some(blob.deserialize()?)),
+        None => Ok(None),
+    }
+}
+
+/// Load from the binary tier if fresh, otherwise return None
+pub fn cache_load_bin_fresh<T: DeserializeOwned>(
+    key: &str,
+    max_age: Duration,
+) -> Result<Option<T>> {
+    let path = cache_path_bin(key);
+
+    if !path.exists() {
+        return Ok(None);
+    }
+
+    let metadata = fs::metadata(&path)?;
+    let modified = metadata.modified()?;
+    let age = SystemTime::now()
+        .duration_since(modified)
+        .unwrap_or(Duration::MAX);
+
+    if age > max_age {
+        return Ok(None);
+    }
+
+    cache_load_bin(key)
+}
+
+/// A validated, memory-mapped binary cache entry. Holding this keeps the
+/// mapping alive; `payload()` exposes the raw bytes without copying them
+/// into the heap, and `deserialize()` decodes on demand — callers that
+/// only need part of the blob (or may not need it at all) defer the parse.
+pub struct CachedBlob {
+    mmap: memmap2::Mmap,
+}
+
+impl CachedBlob {
+    /// Raw payload bytes (header stripped), borrowed from the mapping
+    pub fn payload(&self) -> &[u8] {
+        &self.mmap[BIN_HEADER_LEN..]
+    }
+
+    /// Decode the payload into a value
+    pub fn deserialize<T: DeserializeOwned>(&self) -> Result<T> {
+        Ok(bincode::deserialize(self.payload())?)
+    }
+}
+
+/// Memory-map a binary cache entry after validating its header. Returns
+/// None when the entry is missing or was written by an incompatible
+/// version; corrupt (truncated) entries are errors.
+pub fn cache_load_mmap(key: &str) -> Result<Option<CachedBlob>> {
+    load_blob(&cache_path_bin(key))
+}
+
+fn load_blob(path: &PathBuf) -> Result<Option<CachedBlob>> {
+    if !path.exists() {
+        return Ok(None);
+    }
+
+    let file = fs::File::open(&path)?;
+    // SAFETY: the mapping is read-only; entries are replaced atomically via
+    // rename, so a concurrent writer never mutates the mapped bytes.
+    let mmap = unsafe { memmap2::Mmap::map(&file)? };
+
+    if mmap.len() < BIN_HEADER_LEN {
+        bail!("binary cache entry {} is truncated", path.display());
+    }
+
+    if &mmap[..4] != BIN_MAGIC {
+        return Ok(None);
+    }
+
+    let version = u32::from_le_bytes(mmap[4..8].try_into().unwrap());
+    if version != BIN_FORMAT_VERSION {
+        return Ok(None);
+    }
+
+    Ok(Some(CachedBlob { mmap }))
+}
+
+/// Clear a specific cache entry (both tiers)
 pub fn cache_clear(key: &str) -> Result<()> {
-    let path = cache_path(key);
-    if path.exists() {
-        fs::remove_file(&path)?;
+    for path in [cache_path(key), cache_path_bin(key)] {
+        if path.exists() {
+            fs::remove_file(&path)?;
+        }
     }
     Ok(())
 }
@@ -102,7 +227,11 @@ pub fn cache_stats() -> Result<CacheStats> {
 
     for entry in fs::read_dir(&cache_dir)? {
         let entry = entry?;
-        if entry.path().extension().is_some_and(|e| e == "json") {
+        if entry
+            .path()
+            .extension()
+            .is_some_and(|e| e == "json" || e == "bin")
+        {
             total_size += entry.metadata()?.len();
             file_count += 1;
         }
@@ -133,3 +262,54 @@ impl CacheStats {
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// Serialize/deserialize through the binary header path directly,
+    /// without touching the user-level cache directory.
+    fn encode_bin<T: Serialize>(data: &T) -> Vec<u8> {
+        let mut bytes = Vec::new();
+        bytes.extend_from_slice(BIN_MAGIC);
+        bytes.extend_from_slice(&BIN_FORMAT_VERSION.to_le_bytes());
+        bincode::serialize_into(&mut bytes, data).unwrap();
+        bytes
+    }
+
+    #[test]
+    fn test_bin_roundtrip() {
+        let dir = tempfile::tempdir().unwrap();
+        let path = dir.path().join("entry.bin");
+
+        let data = vec!["alpha".to_string(), "beta".to_string()];
+        fs::write(&path, encode_bin(&data)).unwrap();
+
+        let blob = load_blob(&path).unwrap().expect("blob should load");
+        let decoded: Vec<String> = blob.deserialize().unwrap();
+        assert_eq!(decoded, data);
+    }
+
+    #[test]
+    fn test_bin_version_mismatch_rejected() {
+        let dir = tempfile::tempdir().unwrap();
+        let path = dir.path().join("entry.bin");
+
+        let mut bytes = encode_bin(&42u64);
+        // Entries written by a different format version must read as absent
+        bytes[4..8].copy_from_slice(&(BIN_FORMAT_VERSION + 1).to_le_bytes());
+        fs::write(&path, &bytes).unwrap();
+
+        assert!(load_blob(&path).unwrap().is_none());
+    }
+
+    #[test]
+    fn test_bin_truncated_is_error() {
+        let dir = tempfile::tempdir().unwrap();
+        let path = dir.path().join("entry.bin");
+
+        fs::write(&path, b"CV").unwrap();
+
+        assert!(load_blob(&path).is_err());
+    }
+}
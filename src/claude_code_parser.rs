@@ -1,11 +1,11 @@
 #![allow(dead_code)]
 
+use crate::conversation_store::ConversationStore;
 use anyhow::Result;
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
-use std::fs;
 use std::path::PathBuf;
-use walkdir::WalkDir;
+use std::sync::Arc;
 
 #[derive(Debug, Deserialize)]
 pub struct HistoryEntry {
@@ -33,7 +33,7 @@ pub struct MessageContent {
     pub content: serde_json::Value,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ClaudeCodeStats {
     pub total_prompts: usize,
     pub total_conversations: usize,
@@ -47,12 +47,19 @@ pub struct ClaudeCodeStats {
 }
 
 pub struct ClaudeCodeParser {
-    base_dir: PathBuf,
+    store: Arc<ConversationStore>,
 }
 
 impl ClaudeCodeParser {
     pub fn new(base_dir: PathBuf) -> Self {
-        Self { base_dir }
+        Self {
+            store: ConversationStore::build(&base_dir),
+        }
+    }
+
+    /// Reuses an already-built store instead of re-reading the corpus
+    pub fn with_store(store: Arc<ConversationStore>) -> Self {
+        Self { store }
     }
 
     pub fn parse(&self) -> Result<ClaudeCodeStats> {
@@ -68,107 +75,89 @@ impl ClaudeCodeParser {
             go_on_count: 0,
         };
 
-        // Parse history.jsonl
-        let history_path = self.base_dir.join(".claude/history.jsonl");
-        if history_path.exists() {
-            self.parse_history(&history_path, &mut stats)?;
-        }
+        // Prompt history (.claude/history.jsonl)
+        self.parse_history(&mut stats)?;
 
-        // Parse conversation files in projects/
-        let projects_dir = self.base_dir.join(".claude/projects");
-        if projects_dir.exists() {
-            self.parse_conversations(&projects_dir, &mut stats)?;
-        }
+        // Conversation transcripts (.claude/projects/**/*.jsonl)
+        self.parse_conversations(&mut stats)?;
 
         Ok(stats)
     }
 
-    fn parse_history(&self, path: &PathBuf, stats: &mut ClaudeCodeStats) -> Result<()> {
-        let content = fs::read_to_string(path)?;
-
+    fn parse_history(&self, stats: &mut ClaudeCodeStats) -> Result<()> {
         let frustration_keywords = vec!["wtf", "fuck", "no,", "stop", "please", "beg", "come on"];
 
-        for line in content.lines() {
-            if let Ok(entry) = serde_json::from_str::<HistoryEntry>(line) {
-                stats.total_prompts += 1;
+        // Hot path: the counters only need a few fields, so read them
+        // straight off the shared DOM instead of materializing a
+        // HistoryEntry per line
+        for line in &self.store.claude_history {
+            let Some(display) = line.get("display").and_then(|v| v.as_str()) else {
+                continue;
+            };
 
-                // Track project usage
-                if let Some(project) = entry.project {
-                    *stats.projects.entry(project).or_insert(0) += 1;
-                }
+            stats.total_prompts += 1;
 
-                // Detect "go on"
-                let display_lower = entry.display.to_lowercase();
-                if display_lower == "go on" || display_lower == "go on?" {
-                    stats.go_on_count += 1;
-                }
+            // Track project usage
+            if let Some(project) = line.get("project").and_then(|v| v.as_str()) {
+                *stats.projects.entry(project.to_string()).or_insert(0) += 1;
+            }
 
-                // Detect frustration
-                for keyword in &frustration_keywords {
-                    if display_lower.contains(keyword) {
-                        if stats.frustration_prompts.len() < 10 {
-                            stats.frustration_prompts.push(entry.display.clone());
-                        }
-                        break;
+            // Detect "go on"
+            let display_lower = display.to_lowercase();
+            if display_lower == "go on" || display_lower == "go on?" {
+                stats.go_on_count += 1;
+            }
+
+            // Detect frustration
+            for keyword in &frustration_keywords {
+                if display_lower.contains(keyword) {
+                    if stats.frustration_prompts.len() < 10 {
+                        stats.frustration_prompts.push(display.to_string());
                     }
+                    break;
                 }
-
-                // Estimate tokens from prompt length
-                stats.estimated_tokens += (entry.display.len() / 4) as u64;
             }
+
+            // Estimate tokens from prompt length
+            stats.estimated_tokens += (display.len() / 4) as u64;
         }
 
         Ok(())
     }
 
-    fn parse_conversations(
-        &self,
-        projects_dir: &PathBuf,
-        stats: &mut ClaudeCodeStats,
-    ) -> Result<()> {
-        for entry in WalkDir::new(projects_dir)
-            .into_iter()
-            .filter_map(|e| e.ok())
-        {
-            if !entry.file_type().is_file() {
-                continue;
-            }
+    fn parse_conversations(&self, stats: &mut ClaudeCodeStats) -> Result<()> {
+        for file in &self.store.claude_projects {
+            let mut has_messages = false;
 
-            let path = entry.path();
-            if let Some(ext) = path.extension() {
-                if ext != "jsonl" {
+            // Hot path: only role and content length matter here, so read
+            // them lazily from the DOM instead of deserializing a
+            // ConversationMessage per line
+            for line in &file.lines {
+                let Some(message) = line.get("message") else {
                     continue;
-                }
-            } else {
-                continue;
-            }
+                };
+                let Some(role) = message.get("role").and_then(|v| v.as_str()) else {
+                    continue;
+                };
+                let Some(content) = message.get("content") else {
+                    continue;
+                };
 
-            // Parse conversation file
-            if let Ok(content) = fs::read_to_string(path) {
-                let mut has_messages = false;
-
-                for line in content.lines() {
-                    if let Ok(msg) = serde_json::from_str::<ConversationMessage>(line) {
-                        if let Some(message_content) = msg.message {
-                            has_messages = true;
-                            stats.total_messages += 1;
-
-                            if message_content.role == "user" {
-                                stats.user_messages += 1;
-                            } else if message_content.role == "assistant" {
-                                stats.assistant_messages += 1;
-                            }
-
-                            // Estimate tokens
-                            let content_str = message_content.content.to_string();
-                            stats.estimated_tokens += (content_str.len() / 4) as u64;
-                        }
-                    }
-                }
+                has_messages = true;
+                stats.total_messages += 1;
 
-                if has_messages {
-                    stats.total_conversations += 1;
+                if role == "user" {
+                    stats.user_messages += 1;
+                } else if role == "assistant" {
+                    stats.assistant_messages += 1;
                 }
+
+                // Estimate tokens
+                stats.estimated_tokens += (content.to_string().len() / 4) as u64;
+            }
+
+            if has_messages {
+                stats.total_conversations += 1;
             }
         }
 
@@ -1,14 +1,15 @@
 use crate::advanced_analytics::{AdvancedAnalytics, AdvancedAnalyzer};
 use crate::claude_code_parser::{ClaudeCodeParser, ClaudeCodeStats};
+use crate::conversation_store::{self, ConversationStore};
 use crate::viral_insights::{ViralAnalyzer, ViralInsights};
 use crate::work_hours_analyzer::{WorkHoursAnalysis, WorkHoursAnalyzer};
 use anyhow::Result;
+use rayon::prelude::*;
 use serde::{Deserialize, Serialize};
 use std::collections::{HashMap, HashSet};
-use std::fs;
 use std::path::PathBuf;
-use tracing::info;
-use walkdir::WalkDir;
+use std::sync::Arc;
+use tracing::{info, info_span};
 
 /// Context for parsing conversation tasks - groups mutable state to reduce function arguments
 struct ParseContext<'a> {
@@ -21,7 +22,7 @@ struct ParseContext<'a> {
     files_referenced: &'a mut HashSet<String>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ComprehensiveAnalysis {
     pub conversations: ConversationAnalysis,
     pub token_usage: TokenUsage,
@@ -36,7 +37,7 @@ pub struct ComprehensiveAnalysis {
     pub advanced: AdvancedAnalytics,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ConversationAnalysis {
     pub total_conversations: usize,
     pub total_messages: usize,
@@ -48,7 +49,7 @@ pub struct ConversationAnalysis {
     pub files_referenced: Vec<String>, // Files mentioned in conversations
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ConversationInfo {
     pub tool: String,
     pub messages: usize,
@@ -56,7 +57,7 @@ pub struct ConversationInfo {
     pub path: String,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ConversationStats {
     pub conversations: usize,
     pub messages: usize,
@@ -65,7 +66,7 @@ pub struct ConversationStats {
     pub avg_message_length: f64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct TokenUsage {
     pub total_input_tokens: u64,
     pub total_output_tokens: u64,
@@ -74,14 +75,14 @@ pub struct TokenUsage {
     pub by_model: HashMap<String, u64>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ToolTokens {
     pub input: u64,
     pub output: u64,
     pub total: u64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct CodeAttribution {
     pub total_lines_tracked: usize,
     pub ai_generated_lines: usize,
@@ -89,7 +90,7 @@ pub struct CodeAttribution {
     pub by_composer: HashMap<String, usize>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct CostAnalysis {
     pub total_cost_usd: f64,
     pub by_tool: HashMap<String, f64>,
@@ -98,13 +99,13 @@ pub struct CostAnalysis {
     pub potential_savings: f64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ModelCost {
     pub tokens: u64,
     pub cost: f64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ProductivityMetrics {
     pub total_sessions: usize,
     pub average_session_duration: f64,
@@ -114,42 +115,42 @@ pub struct ProductivityMetrics {
     pub most_active_hours: Vec<usize>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct LanguageStats {
     pub by_language: HashMap<String, LanguageUsage>,
     pub most_used_language: String,
     pub framework_mentions: HashMap<String, usize>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct LanguageUsage {
     pub files: usize,
     pub lines_of_code: usize,
     pub conversations: usize,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ToolComparison {
     pub by_effectiveness: Vec<ToolEffectiveness>,
     pub by_cost_efficiency: Vec<ToolCostEfficiency>,
     pub by_usage: Vec<ToolUsage>,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ToolEffectiveness {
     pub tool: String,
     pub success_rate: f64,
     pub avg_tokens_per_task: f64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ToolCostEfficiency {
     pub tool: String,
     pub cost_per_conversation: f64,
     pub tokens_per_dollar: f64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ToolUsage {
     pub tool: String,
     pub conversations: usize,
@@ -181,24 +182,66 @@ struct ModelUsage {
     output_tokens: Option<u64>,
 }
 
+/// Per-conversation metrics extracted in parallel, merged sequentially
+struct TaskSummary {
+    tool: String,
+    path: String,
+    msg_count: usize,
+    user_count: usize,
+    assistant_count: usize,
+    char_count: usize,
+    files_referenced: Vec<String>,
+}
+
+/// Per-thread partial token counts, merged associatively
+#[derive(Default)]
+struct TokenPartial {
+    input: u64,
+    output: u64,
+    by_tool: HashMap<String, (u64, u64)>, // (input, output)
+}
+
+impl TokenPartial {
+    fn merge(mut self, other: Self) -> Self {
+        self.input += other.input;
+        self.output += other.output;
+        for (tool, (input, output)) in other.by_tool {
+            let entry = self.by_tool.entry(tool).or_insert((0, 0));
+            entry.0 += input;
+            entry.1 += output;
+        }
+        self
+    }
+}
+
 pub struct ComprehensiveAnalyzer {
     base_dir: PathBuf,
+    store: Arc<ConversationStore>,
 }
 
 impl ComprehensiveAnalyzer {
     pub fn new(base_dir: PathBuf) -> Self {
-        Self { base_dir }
+        let store = ConversationStore::build(&base_dir);
+        Self { base_dir, store }
     }
 
     pub fn analyze(&self) -> Result<ComprehensiveAnalysis> {
+        let _span = info_span!("comprehensive_analyze").entered();
         info!("🔍 Starting comprehensive analysis of 52+ GB data...");
 
-        let mut conv_analysis = self.analyze_conversations()?;
-        let mut token_usage = self.analyze_tokens()?;
+        let mut conv_analysis = {
+            let _span = info_span!("analyze_conversations").entered();
+            self.analyze_conversations()?
+        };
+        let mut token_usage = {
+            let _span = info_span!("analyze_tokens").entered();
+            self.analyze_tokens()?
+        };
 
-        // Parse Claude Code logs
+        // Parse Claude Code logs (from the shared store, no re-read)
         info!("📊 Parsing Claude Code logs...");
-        let claude_parser = ClaudeCodeParser::new(self.base_dir.clone());
+        let claude_span = info_span!("claude_code_parse").entered();
+        let claude_parser = ClaudeCodeParser::with_store(Arc::clone(&self.store));
         let claude_stats = claude_parser.parse().unwrap_or_else(|e| {
             info!("Failed to parse Claude Code logs: {}", e);
             ClaudeCodeStats {
@@ -213,6 +256,7 @@ impl ComprehensiveAnalyzer {
                 go_on_count: 0,
             }
         });
+        drop(claude_span);
 
         // Add Claude Code stats to totals
         conv_analysis.total_conversations += claude_stats.total_conversations;
@@ -223,30 +267,45 @@ impl ComprehensiveAnalyzer {
         token_usage.total_input_tokens += (claude_stats.estimated_tokens as f64 * 0.6) as u64;
         token_usage.total_output_tokens += (claude_stats.estimated_tokens as f64 * 0.4) as u64;
 
-        let code_attribution = self.analyze_code_attribution()?;
+        let code_attribution = {
+            let _span = info_span!("analyze_code_attribution").entered();
+            self.analyze_code_attribution()?
+        };
         let cost_analysis = self.calculate_costs(&token_usage)?;
         let productivity = self.analyze_productivity()?;
-        let language_stats = self.analyze_languages()?;
+        let language_stats = {
+            let _span = info_span!("analyze_languages").entered();
+            self.analyze_languages()?
+        };
         let tool_comparison = self.compare_tools(&conv_analysis, &token_usage, &cost_analysis)?;
 
         // Generate viral insights
         info!("🎉 Generating viral insights...");
-        let viral_analyzer = ViralAnalyzer::new(
-            self.base_dir.clone(),
-            token_usage.total_tokens,
-            cost_analysis.total_cost_usd,
-        );
-        let viral_insights = viral_analyzer.analyze()?;
+        let viral_insights = {
+            let _span = info_span!("viral_insights").entered();
+            let viral_analyzer = ViralAnalyzer::new(
+                self.base_dir.clone(),
+                token_usage.total_tokens,
+                cost_analysis.total_cost_usd,
+            );
+            viral_analyzer.analyze()?
+        };
 
         // Analyze work hours
         info!("⏱️  Analyzing work hours from timestamps...");
-        let hours_analyzer = WorkHoursAnalyzer::new(self.base_dir.clone());
-        let work_hours = hours_analyzer.analyze()?;
+        let work_hours = {
+            let _span = info_span!("work_hours").entered();
+            let hours_analyzer = WorkHoursAnalyzer::with_store(Arc::clone(&self.store));
+            hours_analyzer.analyze()?
+        };
 
         // Advanced analytics
         info!("🔬 Running advanced analytics...");
-        let advanced_analyzer = AdvancedAnalyzer::new(self.base_dir.clone());
-        let advanced = advanced_analyzer.analyze()?;
+        let advanced = {
+            let _span = info_span!("advanced_analytics").entered();
+            let advanced_analyzer = AdvancedAnalyzer::new(self.base_dir.clone());
+            advanced_analyzer.analyze()?
+        };
 
         Ok(ComprehensiveAnalysis {
             conversations: conv_analysis,
@@ -310,89 +369,75 @@ impl ComprehensiveAnalyzer {
     }
 
     fn parse_cline_tasks(&self, ctx: &mut ParseContext<'_>) -> Result<()> {
-        let patterns = vec![
-            ("Cline", ".config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks"),
-            ("Cline (Flatpak)", ".var/app/com.visualstudio.code/config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks"),
-            ("Kilo", ".config/Code/User/globalStorage/kilocode.kilo-code/tasks"),
-            ("Roo-Cline", ".config/Code/User/globalStorage/rooveterinaryinc.roo-cline/tasks"),
-            ("Roo-Cline (Cursor)", ".config/Cursor/User/globalStorage/rooveterinaryinc.roo-cline/tasks"),
-        ];
-
-        for (tool_name, pattern) in patterns {
-            let path = self.base_dir.join(pattern);
-            if !path.exists() {
-                continue;
-            }
-
-            for entry in WalkDir::new(&path)
-                .min_depth(1)
-                .max_depth(1)
-                .into_iter()
-                .filter_map(|e| e.ok())
-            {
-                if !entry.file_type().is_dir() {
-                    continue;
+        // Conversations are independent: extract per-task summaries in
+        // parallel, then fold the cheap partials sequentially
+        let summaries: Vec<TaskSummary> = self
+            .store
+            .cline_tasks
+            .par_iter()
+            .filter_map(|task| {
+                let messages: Vec<ClineMessage> = task
+                    .messages
+                    .iter()
+                    .filter_map(conversation_store::view)
+                    .collect();
+                if messages.is_empty() {
+                    return None;
                 }
 
-                let api_history = entry.path().join("api_conversation_history.json");
-                if !api_history.exists() {
-                    continue;
-                }
-
-                if let Ok(content) = fs::read_to_string(&api_history) {
-                    if let Ok(messages) = serde_json::from_str::<Vec<ClineMessage>>(&content) {
-                        let msg_count = messages.len();
-                        let user_count = messages.iter().filter(|m| m.role == "user").count();
-                        let assistant_count =
-                            messages.iter().filter(|m| m.role == "assistant").count();
-
-                        // Collect files referenced in context from metadata
-                        for msg in &messages {
-                            if let Some(meta) = &msg.metadata {
-                                if let Some(files) = &meta.files_in_context {
-                                    for file in files {
-                                        ctx.files_referenced.insert(file.clone());
-                                    }
-                                }
-                            }
-                        }
-
-                        *ctx.total_conversations += 1;
-                        *ctx.total_messages += msg_count;
-                        *ctx.total_user += user_count;
-                        *ctx.total_assistant += assistant_count;
-
-                        // Track largest conversation
-                        if msg_count > ctx.largest.messages {
-                            ctx.largest.tool = tool_name.to_string();
-                            ctx.largest.messages = msg_count;
-                            ctx.largest.path = api_history.to_string_lossy().to_string();
-
-                            // Estimate tokens
-                            let char_count: usize =
-                                messages.iter().map(|m| m.content.to_string().len()).sum();
-                            ctx.largest.tokens = (char_count / 4) as u64;
+                let mut files_referenced = Vec::new();
+                for msg in &messages {
+                    if let Some(meta) = &msg.metadata {
+                        if let Some(files) = &meta.files_in_context {
+                            files_referenced.extend(files.iter().cloned());
                         }
-
-                        // Update tool stats
-                        let stats =
-                            ctx.by_tool
-                                .entry(tool_name.to_string())
-                                .or_insert(ConversationStats {
-                                    conversations: 0,
-                                    messages: 0,
-                                    user_messages: 0,
-                                    assistant_messages: 0,
-                                    avg_message_length: 0.0,
-                                });
-
-                        stats.conversations += 1;
-                        stats.messages += msg_count;
-                        stats.user_messages += user_count;
-                        stats.assistant_messages += assistant_count;
                     }
                 }
+
+                let char_count: usize =
+                    messages.iter().map(|m| m.content.to_string().len()).sum();
+
+                Some(TaskSummary {
+                    tool: task.tool.clone(),
+                    path: task.path.to_string_lossy().to_string(),
+                    msg_count: messages.len(),
+                    user_count: messages.iter().filter(|m| m.role == "user").count(),
+                    assistant_count: messages.iter().filter(|m| m.role == "assistant").count(),
+                    char_count,
+                    files_referenced,
+                })
+            })
+            .collect();
+
+        for summary in summaries {
+            ctx.files_referenced.extend(summary.files_referenced);
+
+            *ctx.total_conversations += 1;
+            *ctx.total_messages += summary.msg_count;
+            *ctx.total_user += summary.user_count;
+            *ctx.total_assistant += summary.assistant_count;
+
+            // Track largest conversation
+            if summary.msg_count > ctx.largest.messages {
+                ctx.largest.tool = summary.tool.clone();
+                ctx.largest.messages = summary.msg_count;
+                ctx.largest.path = summary.path;
+                ctx.largest.tokens = (summary.char_count / 4) as u64;
             }
+
+            // Update tool stats
+            let stats = ctx.by_tool.entry(summary.tool).or_insert(ConversationStats {
+                conversations: 0,
+                messages: 0,
+                user_messages: 0,
+                assistant_messages: 0,
+                avg_message_length: 0.0,
+            });
+
+            stats.conversations += 1;
+            stats.messages += summary.msg_count;
+            stats.user_messages += summary.user_count;
+            stats.assistant_messages += summary.assistant_count;
         }
 
         // Calculate averages
@@ -408,86 +453,78 @@ impl ComprehensiveAnalyzer {
     fn analyze_tokens(&self) -> Result<TokenUsage> {
         info!("💰 Analyzing token usage (estimating from message lengths)...");
 
-        let mut total_input = 0u64;
-        let mut total_output = 0u64;
-        let mut by_tool: HashMap<String, ToolTokens> = HashMap::new();
         let mut by_model: HashMap<String, u64> = HashMap::new();
 
-        // Parse token data from API conversation history
-        let patterns = vec![
-            ("Cline", ".config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks"),
-            ("Cline (Flatpak)", ".var/app/com.visualstudio.code/config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks"),
-            ("Kilo", ".config/Code/User/globalStorage/kilocode.kilo-code/tasks"),
-            ("Roo-Cline", ".config/Code/User/globalStorage/rooveterinaryinc.roo-cline/tasks"),
-            ("Roo-Cline (Cursor)", ".config/Cursor/User/globalStorage/rooveterinaryinc.roo-cline/tasks"),
-        ];
-
-        for (tool_name, pattern) in patterns {
-            let path = self.base_dir.join(pattern);
-            if !path.exists() {
-                continue;
-            }
-
-            for entry in WalkDir::new(&path)
-                .min_depth(1)
-                .max_depth(1)
-                .into_iter()
-                .filter_map(|e| e.ok())
-            {
-                let api_history = entry.path().join("api_conversation_history.json");
-                if !api_history.exists() {
-                    continue;
-                }
-
-                if let Ok(content) = fs::read_to_string(&api_history) {
-                    if let Ok(messages) = serde_json::from_str::<Vec<ClineMessage>>(&content) {
-                        for msg in &messages {
-                            // First try to use actual token counts from metadata
-                            let (input_tokens, output_tokens) = if let Some(meta) = &msg.metadata {
-                                if let Some(usage) = &meta.model_usage {
-                                    (
-                                        usage.input_tokens.unwrap_or(0),
-                                        usage.output_tokens.unwrap_or(0),
-                                    )
-                                } else {
-                                    // Estimate from content if no usage data
-                                    let content_str = msg.content.to_string();
-                                    let estimated = (content_str.len() / 4) as u64;
-                                    if msg.role == "user" {
-                                        (estimated, 0)
-                                    } else {
-                                        (0, estimated)
-                                    }
-                                }
+        // Parse token data from the shared conversation store: each task
+        // is counted independently, then partials are merged associatively
+        let partial = self
+            .store
+            .cline_tasks
+            .par_iter()
+            .map(|task| {
+                let mut partial = TokenPartial::default();
+
+                for value in &task.messages {
+                    let Some(msg) = conversation_store::view::<ClineMessage>(value) else {
+                        continue;
+                    };
+
+                    // First try to use actual token counts from metadata
+                    let (input_tokens, output_tokens) = if let Some(meta) = &msg.metadata {
+                        if let Some(usage) = &meta.model_usage {
+                            (
+                                usage.input_tokens.unwrap_or(0),
+                                usage.output_tokens.unwrap_or(0),
+                            )
+                        } else {
+                            // Estimate from content if no usage data
+                            let content_str = msg.content.to_string();
+                            let estimated = (content_str.len() / 4) as u64;
+                            if msg.role == "user" {
+                                (estimated, 0)
                             } else {
-                                // Fallback: estimate ~4 characters per token
-                                let content_str = msg.content.to_string();
-                                let estimated = (content_str.len() / 4) as u64;
-                                if msg.role == "user" {
-                                    (estimated, 0)
-                                } else {
-                                    (0, estimated)
-                                }
-                            };
-
-                            total_input += input_tokens;
-                            total_output += output_tokens;
+                                (0, estimated)
+                            }
+                        }
+                    } else {
+                        // Fallback: estimate ~4 characters per token
+                        let content_str = msg.content.to_string();
+                        let estimated = (content_str.len() / 4) as u64;
+                        if msg.role == "user" {
+                            (estimated, 0)
+                        } else {
+                            (0, estimated)
+                        }
+                    };
 
-                            let tool_tokens =
-                                by_tool.entry(tool_name.to_string()).or_insert(ToolTokens {
-                                    input: 0,
-                                    output: 0,
-                                    total: 0,
-                                });
+                    partial.input += input_tokens;
+                    partial.output += output_tokens;
 
-                            tool_tokens.input += input_tokens;
-                            tool_tokens.output += output_tokens;
-                            tool_tokens.total += input_tokens + output_tokens;
-                        }
-                    }
+                    let entry = partial.by_tool.entry(task.tool.clone()).or_insert((0, 0));
+                    entry.0 += input_tokens;
+                    entry.1 += output_tokens;
                 }
-            }
-        }
+
+                partial
+            })
+            .reduce(TokenPartial::default, TokenPartial::merge);
+
+        let total_input = partial.input;
+        let total_output = partial.output;
+        let by_tool: HashMap<String, ToolTokens> = partial
+            .by_tool
+            .into_iter()
+            .map(|(tool, (input, output))| {
+                (
+                    tool,
+                    ToolTokens {
+                        input,
+                        output,
+                        total: input + output,
+                    },
+                )
+            })
+            .collect();
 
         // Assume Claude Sonnet 3.5 as default model
         *by_model.entry("claude-sonnet-3.5".to_string()).or_insert(0) = total_input + total_output;
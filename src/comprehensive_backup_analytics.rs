@@ -4,7 +4,6 @@ use serde::{Deserialize, Serialize};
 use std::path::PathBuf;
 
 use crate::ai_impact_analyzer::{AIImpactAnalyzer, AIImpactReport};
-use crate::history_sanitizer::HistorySanitizer;
 use crate::shell_analytics::{ShellAnalytics, ShellAnalyzer};
 use crate::workflow_correlation::{WorkflowAnalyzer, WorkflowCorrelation};
 
@@ -64,24 +63,10 @@ impl ComprehensiveAnalyticsEngine {
         ai_analyzer.load_git_commits(git_repos)?;
         let ai_impact = ai_analyzer.analyze();
 
-        // 2. Shell Productivity Analysis
+        // 2. Shell Productivity Analysis (incremental: only the tail
+        // appended since the last run is sanitized and parsed)
         println!("  Analyzing shell command patterns...");
-        let mut shell_analyzer = ShellAnalyzer::new();
-
-        let sanitizer = HistorySanitizer::new();
-        let histories = sanitizer.find_and_sanitize_history(&self.home_dir)?;
-
-        for (filename, content) in &histories {
-            let shell_type = if filename.contains("zsh") {
-                "zsh"
-            } else if filename.contains("bash") {
-                "bash"
-            } else {
-                "unknown"
-            };
-            shell_analyzer.load_history(content, shell_type);
-        }
-        let shell_analytics = shell_analyzer.analyze();
+        let shell_analytics = ShellAnalyzer::analyze_incremental(&self.home_dir)?;
 
         // 3. Workflow Correlation Analysis
         println!("  Correlating workflows across tools...");
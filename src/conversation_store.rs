@@ -0,0 +1,202 @@
+// Session-scoped store of parsed conversation files.
+//
+// ComprehensiveAnalyzer, WorkHoursAnalyzer, ConversationAnalyzer, and
+// ClaudeCodeParser all consume the same Cline task files and Claude Code
+// history, and previously each re-opened and re-parsed them from disk.
+// The store reads and JSON-parses every file exactly once into a shared
+// immutable DOM; analyzers take an Arc to the store and deserialize their
+// own typed views from the parsed values, which costs no I/O and no
+// re-lexing.
+#![allow(dead_code)]
+
+use rayon::prelude::*;
+use serde::de::DeserializeOwned;
+use serde_json::Value;
+use std::fs;
+use std::path::{Path, PathBuf};
+use std::sync::Arc;
+use walkdir::WalkDir;
+
+/// Cline-family task directories scanned for conversation history
+/// (union of the patterns the analyzers previously scanned separately)
+pub const CLINE_TASK_PATTERNS: &[(&str, &str)] = &[
+    ("Cline", ".config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks"),
+    ("Cline (Flatpak)", ".var/app/com.visualstudio.code/config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks"),
+    ("Kilo", ".config/Code/User/globalStorage/kilocode.kilo-code/tasks"),
+    ("Kilo (Flatpak)", ".var/app/com.visualstudio.code/config/Code/User/globalStorage/kilocode.kilo-code/tasks"),
+    ("Roo-Cline", ".config/Code/User/globalStorage/rooveterinaryinc.roo-cline/tasks"),
+    ("Roo-Cline (Cursor)", ".config/Cursor/User/globalStorage/rooveterinaryinc.roo-cline/tasks"),
+];
+
+/// One Cline/Kilo/Roo-Cline task, parsed once
+pub struct ClineTask {
+    /// Display name from CLINE_TASK_PATTERNS (e.g. "Cline (Flatpak)")
+    pub tool: String,
+
+    /// Path to api_conversation_history.json
+    pub path: PathBuf,
+
+    /// Message objects from api_conversation_history.json
+    pub messages: Vec<Value>,
+
+    /// task_metadata.json, when present
+    pub metadata: Option<Value>,
+}
+
+impl ClineTask {
+    /// Tool name without the install-variant suffix ("Cline (Flatpak)"
+    /// -> "Cline"), for analyzers that aggregate per base tool
+    pub fn base_tool(&self) -> &str {
+        self.tool.split(" (").next().unwrap_or(&self.tool)
+    }
+}
+
+/// One Claude Code conversation transcript under .claude/projects/
+pub struct ClaudeProjectFile {
+    pub path: PathBuf,
+
+    /// One parsed object per JSONL line
+    pub lines: Vec<Value>,
+}
+
+pub struct ConversationStore {
+    /// Parsed lines of .claude/history.jsonl (prompt history)
+    pub claude_history: Vec<Value>,
+
+    /// Conversation transcripts under .claude/projects/**/*.jsonl
+    pub claude_projects: Vec<ClaudeProjectFile>,
+
+    /// Cline-family tasks across all scanned install locations
+    pub cline_tasks: Vec<ClineTask>,
+}
+
+impl ConversationStore {
+    /// Builds the store by reading and parsing every conversation file
+    /// under `base_dir` once, in parallel. Unreadable or malformed files
+    /// are skipped, matching the lenient per-file handling the analyzers
+    /// used when parsing from disk themselves.
+    pub fn build(base_dir: &Path) -> Arc<Self> {
+        let claude_history = load_jsonl(&base_dir.join(".claude/history.jsonl"));
+
+        // Collect transcript paths first so parsing can fan out
+        let mut project_paths = Vec::new();
+        let projects_dir = base_dir.join(".claude/projects");
+        if projects_dir.exists() {
+            for entry in WalkDir::new(&projects_dir)
+                .into_iter()
+                .filter_map(|e| e.ok())
+            {
+                if entry.file_type().is_file()
+                    && entry.path().extension().is_some_and(|ext| ext == "jsonl")
+                {
+                    project_paths.push(entry.path().to_path_buf());
+                }
+            }
+        }
+
+        let claude_projects: Vec<ClaudeProjectFile> = project_paths
+            .par_iter()
+            .map(|path| ClaudeProjectFile {
+                path: path.clone(),
+                lines: load_jsonl(path),
+            })
+            .filter(|file| !file.lines.is_empty())
+            .collect();
+
+        // Collect task directories, then parse their histories in parallel
+        let mut task_dirs: Vec<(&'static str, PathBuf)> = Vec::new();
+        for (tool_name, pattern) in CLINE_TASK_PATTERNS {
+            let path = base_dir.join(pattern);
+            if !path.exists() {
+                continue;
+            }
+
+            for entry in WalkDir::new(&path)
+                .min_depth(1)
+                .max_depth(1)
+                .into_iter()
+                .filter_map(|e| e.ok())
+            {
+                if entry.file_type().is_dir() {
+                    task_dirs.push((tool_name, entry.path().to_path_buf()));
+                }
+            }
+        }
+
+        let cline_tasks: Vec<ClineTask> = task_dirs
+            .par_iter()
+            .filter_map(|(tool_name, dir)| {
+                let api_history = dir.join("api_conversation_history.json");
+                let messages = match parse_json_file(&api_history)? {
+                    Value::Array(messages) => messages,
+                    _ => return None,
+                };
+
+                let metadata = fs::read_to_string(dir.join("task_metadata.json"))
+                    .ok()
+                    .and_then(|content| serde_json::from_str(&content).ok());
+
+                Some(ClineTask {
+                    tool: tool_name.to_string(),
+                    path: api_history,
+                    messages,
+                    metadata,
+                })
+            })
+            .collect();
+
+        Arc::new(Self {
+            claude_history,
+            claude_projects,
+            cline_tasks,
+        })
+    }
+}
+
+/// Deserializes a shared message DOM into an analyzer's own view type.
+/// Returns None when the shape doesn't match, mirroring the lenient
+/// per-entry error handling used when analyzers parsed files directly.
+pub fn view<T: DeserializeOwned>(value: &Value) -> Option<T> {
+    T::deserialize(value).ok()
+}
+
+/// SIMD-accelerated parse of one JSON document into a serde_json DOM.
+/// simd-json parses in place, so the input is copied into the caller's
+/// scratch buffer first; records the fast path rejects fall back to
+/// serde_json so nothing previously parseable is lost.
+pub fn parse_json_str(input: &str, scratch: &mut Vec<u8>) -> Option<Value> {
+    scratch.clear();
+    scratch.extend_from_slice(input.as_bytes());
+    match simd_json::serde::from_slice(scratch) {
+        Ok(value) => Some(value),
+        Err(_) => serde_json::from_str(input).ok(),
+    }
+}
+
+/// Parses a whole JSON file through the SIMD fast path, reading it as
+/// bytes so simd-json can mutate the buffer in place. The serde fallback
+/// re-reads the file because the fast path may have scribbled on it.
+fn parse_json_file(path: &Path) -> Option<Value> {
+    let mut bytes = fs::read(path).ok()?;
+    match simd_json::serde::from_slice(&mut bytes) {
+        Ok(value) => Some(value),
+        Err(_) => {
+            let bytes = fs::read(path).ok()?;
+            serde_json::from_slice(&bytes).ok()
+        }
+    }
+}
+
+/// Parses a JSONL file into one Value per non-empty line
+fn load_jsonl(path: &Path) -> Vec<Value> {
+    let Ok(content) = fs::read_to_string(path) else {
+        return Vec::new();
+    };
+
+    let mut scratch = Vec::new();
+    content
+        .lines()
+        .filter(|line| !line.trim().is_empty())
+        .filter_map(|line| parse_json_str(line, &mut scratch))
+        .collect()
+}
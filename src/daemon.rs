@@ -1,8 +1,19 @@
 // LLM Daemon - Keeps model loaded in memory for fast queries
 // Unix-only: Uses Unix domain sockets for IPC
-
+//
+// Besides the embedded LLM, the daemon acts as a warm analysis server: a
+// background thread keeps a fully computed ComprehensiveAnalysis and an
+// up-to-date search index in memory/on disk, refreshing them whenever the
+// log corpus changes, so CLI commands that would otherwise re-parse
+// gigabytes of logs can fetch the cached result over the socket instead.
+
+use crate::comprehensive_analyzer::{ComprehensiveAnalysis, ComprehensiveAnalyzer};
+#[cfg(unix)]
+use crate::conversation_store::CLINE_TASK_PATTERNS;
 #[cfg(unix)]
 use crate::embedded_llm::{DeviceType, EmbeddedLlm, Quantization};
+#[cfg(unix)]
+use crate::search::IndexBuilder;
 use anyhow::{anyhow, Result};
 #[cfg(unix)]
 use std::fs;
@@ -10,14 +21,33 @@ use std::fs;
 use std::io::{BufRead, BufReader, Write};
 #[cfg(unix)]
 use std::os::unix::net::{UnixListener, UnixStream};
+#[cfg(unix)]
+use std::path::Path;
 use std::path::PathBuf;
 #[cfg(unix)]
 use std::sync::{Arc, Mutex};
 #[cfg(unix)]
 use std::thread;
+#[cfg(unix)]
+use std::time::Duration;
+#[cfg(unix)]
+use walkdir::WalkDir;
 
 const SOCKET_NAME: &str = "vibedev.sock";
 
+/// How often the warm analysis thread re-checks the corpus for changes
+#[cfg(unix)]
+const WARM_REFRESH_SECS: u64 = 30;
+
+/// Cached analysis state kept warm by the background refresher
+#[cfg(unix)]
+#[derive(Default)]
+struct WarmState {
+    /// Compact JSON of the latest ComprehensiveAnalysis, ready to send
+    insights_json: Option<String>,
+    refreshed_at: Option<String>,
+}
+
 /// Get the socket path
 pub fn get_socket_path() -> PathBuf {
     dirs::runtime_dir()
@@ -113,6 +143,59 @@ pub fn status() -> Result<String> {
     Err(anyhow!("Daemon mode is only supported on Unix systems"))
 }
 
+/// Fetch the warm analysis from a running daemon
+#[cfg(unix)]
+pub fn fetch_insights() -> Result<serde_json::Value> {
+    let socket_path = get_socket_path();
+    let mut stream =
+        UnixStream::connect(&socket_path).map_err(|_| anyhow!("Daemon not running"))?;
+
+    let request = serde_json::json!({ "type": "insights" });
+    writeln!(stream, "{}", request)?;
+    stream.flush()?;
+
+    let mut reader = BufReader::new(stream);
+    let mut response = String::new();
+    reader.read_line(&mut response)?;
+
+    let mut resp: serde_json::Value = serde_json::from_str(&response)?;
+
+    if let Some(error) = resp.get("error") {
+        Err(anyhow!("{}", error.as_str().unwrap_or("Unknown error")))
+    } else if let Some(insights) = resp.get_mut("insights") {
+        Ok(insights.take())
+    } else {
+        Err(anyhow!("Invalid response from daemon"))
+    }
+}
+
+#[cfg(not(unix))]
+pub fn fetch_insights() -> Result<serde_json::Value> {
+    Err(anyhow!("Daemon mode is only supported on Unix systems"))
+}
+
+/// Get comprehensive insights, preferring the daemon's warm cache.
+/// Falls back to a full local analysis pass when the daemon is not
+/// running or is still warming up.
+#[cfg(unix)]
+pub fn insights_or_analyze(base_dir: PathBuf) -> Result<ComprehensiveAnalysis> {
+    if is_running() {
+        if let Ok(value) = fetch_insights() {
+            if let Ok(insights) = serde_json::from_value::<ComprehensiveAnalysis>(value) {
+                println!("⚡ Using warm analysis from daemon");
+                return Ok(insights);
+            }
+        }
+    }
+
+    ComprehensiveAnalyzer::new(base_dir).analyze()
+}
+
+#[cfg(not(unix))]
+pub fn insights_or_analyze(base_dir: PathBuf) -> Result<ComprehensiveAnalysis> {
+    ComprehensiveAnalyzer::new(base_dir).analyze()
+}
+
 /// Stop the daemon
 #[cfg(unix)]
 pub fn stop() -> Result<()> {
@@ -157,8 +240,16 @@ pub fn start(
         fs::remove_file(&socket_path)?;
     }
 
-    // Load the model
     println!("Starting vibedev daemon...");
+
+    // Start warming the analysis cache while the model weights load
+    let warm = Arc::new(Mutex::new(WarmState::default()));
+    {
+        let warm = Arc::clone(&warm);
+        thread::spawn(move || run_warm_refresher(warm));
+    }
+
+    // Load the model
     let llm = EmbeddedLlm::new_with_options(model_id, device_type, quantization)?;
     let llm = Arc::new(Mutex::new(llm));
 
@@ -177,8 +268,9 @@ pub fn start(
         match stream {
             Ok(stream) => {
                 let llm = Arc::clone(&llm);
+                let warm = Arc::clone(&warm);
                 thread::spawn(move || {
-                    if let Err(e) = handle_client(stream, llm) {
+                    if let Err(e) = handle_client(stream, llm, warm) {
                         eprintln!("Client error: {}", e);
                     }
                 });
@@ -201,8 +293,118 @@ pub fn start(
     Err(anyhow!("Daemon mode is only supported on Unix systems (Linux/macOS). On Windows, use 'vibedev chat' directly."))
 }
 
+/// Background thread: keeps the analysis cache and search index in sync
+/// with the log corpus. Re-checks a cheap fingerprint of the watched
+/// directories every WARM_REFRESH_SECS and only redoes the expensive work
+/// when something actually changed.
+#[cfg(unix)]
+fn run_warm_refresher(warm: Arc<Mutex<WarmState>>) {
+    let Some(home) = dirs::home_dir() else {
+        eprintln!("Warm analysis disabled: could not determine home directory");
+        return;
+    };
+
+    let mut last_fingerprint: Option<u64> = None;
+
+    loop {
+        let fingerprint = corpus_fingerprint(&home);
+
+        if last_fingerprint != Some(fingerprint) {
+            println!("Log corpus changed, refreshing warm analysis...");
+
+            match ComprehensiveAnalyzer::new(home.clone()).analyze() {
+                Ok(insights) => match serde_json::to_string(&insights) {
+                    Ok(json) => {
+                        if let Ok(mut state) = warm.lock() {
+                            state.insights_json = Some(json);
+                            state.refreshed_at = Some(chrono::Utc::now().to_rfc3339());
+                        }
+                        println!("Warm analysis ready.");
+                    }
+                    Err(e) => eprintln!("Warm analysis serialization failed: {}", e),
+                },
+                Err(e) => eprintln!("Warm analysis failed: {}", e),
+            }
+
+            if let Err(e) = refresh_search_index() {
+                eprintln!("Search index refresh failed: {}", e);
+            }
+
+            last_fingerprint = Some(fingerprint);
+        }
+
+        thread::sleep(Duration::from_secs(WARM_REFRESH_SECS));
+    }
+}
+
+/// Cheap change detector for the conversation corpus: folds file count,
+/// sizes, and modification times of the watched log directories into a
+/// single value. Any create, delete, or append shifts the fingerprint.
 #[cfg(unix)]
-fn handle_client(stream: UnixStream, llm: Arc<Mutex<EmbeddedLlm>>) -> Result<()> {
+fn corpus_fingerprint(base_dir: &Path) -> u64 {
+    let mut watched = vec![base_dir.join(".claude")];
+    for (_, pattern) in CLINE_TASK_PATTERNS {
+        watched.push(base_dir.join(pattern));
+    }
+
+    let mut fingerprint: u64 = 0;
+    for dir in watched {
+        if !dir.exists() {
+            continue;
+        }
+
+        for entry in WalkDir::new(&dir).into_iter().filter_map(|e| e.ok()) {
+            if !entry.file_type().is_file() {
+                continue;
+            }
+
+            let Ok(meta) = entry.metadata() else {
+                continue;
+            };
+
+            let mtime = meta
+                .modified()
+                .ok()
+                .and_then(|t| t.duration_since(std::time::UNIX_EPOCH).ok())
+                .map(|d| d.as_secs())
+                .unwrap_or(0);
+
+            fingerprint = fingerprint
+                .wrapping_mul(31)
+                .wrapping_add(meta.len())
+                .wrapping_mul(31)
+                .wrapping_add(mtime);
+        }
+    }
+
+    fingerprint
+}
+
+/// Rebuilds or incrementally updates the on-disk tantivy index so
+/// `vibedev search` always finds it fresh
+#[cfg(unix)]
+fn refresh_search_index() -> Result<()> {
+    let index_dir = crate::search::cli::default_index_dir()?;
+
+    let mut builder = IndexBuilder::new(&index_dir)?
+        .with_threads(None)
+        .with_memory_budget_mb(None);
+
+    if index_dir.join("meta.json").exists() {
+        builder.update_index()?;
+    } else {
+        builder.build_initial_index()?;
+    }
+
+    Ok(())
+}
+
+#[cfg(unix)]
+fn handle_client(
+    stream: UnixStream,
+    llm: Arc<Mutex<EmbeddedLlm>>,
+    warm: Arc<Mutex<WarmState>>,
+) -> Result<()> {
     let mut reader = BufReader::new(stream.try_clone()?);
     let mut writer = stream;
 
@@ -224,18 +426,35 @@ fn handle_client(stream: UnixStream, llm: Arc<Mutex<EmbeddedLlm>>) -> Result<()>
             }
 
             match llm.generate(prompt) {
-                Ok(result) => serde_json::json!({ "result": result }),
-                Err(e) => serde_json::json!({ "error": e.to_string() }),
+                Ok(result) => serde_json::json!({ "result": result }).to_string(),
+                Err(e) => serde_json::json!({ "error": e.to_string() }).to_string(),
+            }
+        }
+
+        "insights" => {
+            let state = warm.lock().map_err(|_| anyhow!("Lock error"))?;
+            match &state.insights_json {
+                // The cached analysis is already compact JSON, so splice it
+                // into the response line without re-parsing it
+                Some(json) => format!("{{\"insights\":{}}}", json),
+                None => {
+                    serde_json::json!({ "error": "Analysis still warming up, try again shortly" })
+                        .to_string()
+                }
             }
         }
 
         "status" => {
             let llm = llm.lock().map_err(|_| anyhow!("Lock error"))?;
+            let state = warm.lock().map_err(|_| anyhow!("Lock error"))?;
             serde_json::json!({
                 "status": "running",
                 "model": llm.model_name(),
-                "pid": std::process::id()
+                "pid": std::process::id(),
+                "analysis_warm": state.insights_json.is_some(),
+                "analysis_refreshed_at": state.refreshed_at
             })
+            .to_string()
         }
 
         "shutdown" => {
@@ -243,9 +462,7 @@ fn handle_client(stream: UnixStream, llm: Arc<Mutex<EmbeddedLlm>>) -> Result<()>
             std::process::exit(0);
         }
 
-        _ => {
-            serde_json::json!({ "error": "Unknown request type" })
-        }
+        _ => serde_json::json!({ "error": "Unknown request type" }).to_string(),
     };
 
     writeln!(writer, "{}", response)?;
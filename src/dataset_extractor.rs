@@ -2,13 +2,18 @@
 
 use anyhow::Result;
 use indicatif::{MultiProgress, ProgressBar, ProgressStyle};
+use rayon::prelude::*;
 use serde::{Deserialize, Serialize};
 use std::path::PathBuf;
 
 use crate::comprehensive_analyzer::ComprehensiveAnalysis;
-use crate::extraction_utils::load_all_conversations;
+use crate::extraction_utils::{load_all_conversations, Conversation};
 use crate::extractors::*;
 
+/// One schedulable extractor; tasks only read shared state, so
+/// independent ones can run concurrently
+type ExtractTask<'a> = Box<dyn Fn() -> Result<DatasetInfo> + Send + Sync + 'a>;
+
 /// Master dataset extractor that generates all 37 datasets
 pub struct DatasetExtractor {
     backup_path: PathBuf,
@@ -62,22 +67,71 @@ impl DatasetExtractor {
 
         let multi_progress = MultiProgress::new();
 
-        // Phase 1: Immediate value datasets
-        println!("\n📊 PHASE 1: Immediate Value Datasets");
-        let phase1_datasets = self.extract_phase1(&multi_progress)?;
-
-        // Phase 2: ML datasets
-        println!("\n🤖 PHASE 2: ML Training Datasets");
-        let phase2_datasets = self.extract_phase2(&multi_progress)?;
+        // Shared read-only conversation arena: loaded once here instead
+        // of once per extractor
+        println!("\n📥 Loading conversations (shared across all extractors)...");
+        let base_dir = dirs::home_dir().expect("Could not determine home directory");
+        let conversations = load_all_conversations(&base_dir)?;
+        println!("   {} conversations loaded", conversations.len());
 
-        // Phase 3: Advanced datasets
-        println!("\n🔬 PHASE 3: Advanced Analytics Datasets");
-        let phase3_datasets = self.extract_phase3(&multi_progress)?;
+        println!("\n📊 PHASE 1: Immediate Value Datasets");
+        println!("🤖 PHASE 2: ML Training Datasets");
+        println!("🔬 PHASE 3: Advanced Analytics Datasets");
+        println!("   (independent extractors run concurrently)");
+
+        // Task graph over the arena: every extractor is independent of
+        // the others, so the whole set is scheduled on rayon and the run
+        // is bounded by the slowest single extractor
+        let mp = &multi_progress;
+        let convs = conversations.as_slice();
+        let tasks: Vec<ExtractTask> = vec![
+            // Phase 1: Immediate value datasets
+            Box::new(move || self.extract_time_vampires(mp)),
+            Box::new(move || self.extract_bug_patterns(mp, convs)),
+            Box::new(move || self.extract_cost_patterns(mp)),
+            Box::new(move || self.extract_prompt_patterns(mp, convs)),
+            Box::new(move || self.extract_templates(mp)),
+            // Phase 2: ML datasets
+            Box::new(move || self.extract_agentic_dataset(mp, convs)),
+            Box::new(move || self.extract_debugging_dataset(mp, convs)),
+            Box::new(move || self.extract_long_context_dataset(mp)),
+            // Phase 3: Advanced datasets
+            Box::new(move || self.extract_code_comprehension(mp)),
+            Box::new(move || self.extract_code_evolution(mp)),
+            Box::new(move || self.extract_architecture_decisions(mp)),
+            Box::new(move || self.extract_refactoring_patterns(mp)),
+            Box::new(move || self.extract_test_generation(mp)),
+            Box::new(move || self.extract_context_optimization(mp)),
+            Box::new(move || self.extract_retry_patterns(mp)),
+            Box::new(move || self.extract_multifile_coordination(mp)),
+            Box::new(move || self.extract_learning_curves(mp)),
+            Box::new(move || self.extract_documentation_gaps(mp)),
+            Box::new(move || self.extract_teaching_patterns(mp)),
+            Box::new(move || self.extract_security_patterns(mp)),
+            Box::new(move || self.extract_quality_evolution(mp)),
+            Box::new(move || self.extract_code_review_patterns(mp)),
+            Box::new(move || self.extract_git_workflows(mp)),
+            Box::new(move || self.extract_api_integration(mp)),
+            Box::new(move || self.extract_state_machines(mp)),
+            Box::new(move || self.extract_dependency_selection(mp)),
+            Box::new(move || self.extract_design_patterns(mp)),
+            Box::new(move || self.extract_problem_solving(mp)),
+            Box::new(move || self.extract_decision_making(mp)),
+            Box::new(move || self.extract_error_prediction(mp)),
+            Box::new(move || self.extract_complexity_estimation(mp)),
+            Box::new(move || self.extract_personal_style(mp, convs)),
+            Box::new(move || self.extract_workflow_optimization(mp)),
+            Box::new(move || self.extract_automation_opportunities(mp)),
+            Box::new(move || self.extract_skill_gaps(mp)),
+            Box::new(move || self.extract_project_success_patterns(mp)),
+            Box::new(move || self.extract_knowledge_base(mp)),
+        ];
 
-        let mut all_datasets = Vec::new();
-        all_datasets.extend(phase1_datasets);
-        all_datasets.extend(phase2_datasets);
-        all_datasets.extend(phase3_datasets);
+        // Manifest order stays canonical: par_iter preserves input order
+        let all_datasets: Vec<DatasetInfo> = tasks
+            .par_iter()
+            .map(|task| task())
+            .collect::<Result<Vec<_>>>()?;
 
         let elapsed = start.elapsed().as_secs();
 
@@ -101,73 +155,6 @@ impl DatasetExtractor {
         Ok(manifest)
     }
 
-    fn extract_phase1(&self, mp: &MultiProgress) -> Result<Vec<DatasetInfo>> {
-        let datasets = vec![
-            // 1. Time Vampire Detector
-            self.extract_time_vampires(mp)?,
-            // 2. Personal Bug Patterns
-            self.extract_bug_patterns(mp)?,
-            // 3. AI Cost Optimizer
-            self.extract_cost_patterns(mp)?,
-            // 4. Prompt Engineering Dataset
-            self.extract_prompt_patterns(mp)?,
-            // 5. Code Generation Templates
-            self.extract_templates(mp)?,
-        ];
-
-        Ok(datasets)
-    }
-
-    fn extract_phase2(&self, mp: &MultiProgress) -> Result<Vec<DatasetInfo>> {
-        let datasets = vec![
-            // 6. Agentic Tool Use Dataset
-            self.extract_agentic_dataset(mp)?,
-            // 7. Code Debugging Dataset
-            self.extract_debugging_dataset(mp)?,
-            // 8. Long Context Conversations
-            self.extract_long_context_dataset(mp)?,
-        ];
-
-        Ok(datasets)
-    }
-
-    fn extract_phase3(&self, mp: &MultiProgress) -> Result<Vec<DatasetInfo>> {
-        // 9-37: All the advanced datasets
-        let datasets = vec![
-            self.extract_code_comprehension(mp)?,
-            self.extract_code_evolution(mp)?,
-            self.extract_architecture_decisions(mp)?,
-            self.extract_refactoring_patterns(mp)?,
-            self.extract_test_generation(mp)?,
-            self.extract_context_optimization(mp)?,
-            self.extract_retry_patterns(mp)?,
-            self.extract_multifile_coordination(mp)?,
-            self.extract_learning_curves(mp)?,
-            self.extract_documentation_gaps(mp)?,
-            self.extract_teaching_patterns(mp)?,
-            self.extract_security_patterns(mp)?,
-            self.extract_quality_evolution(mp)?,
-            self.extract_code_review_patterns(mp)?,
-            self.extract_git_workflows(mp)?,
-            self.extract_api_integration(mp)?,
-            self.extract_state_machines(mp)?,
-            self.extract_dependency_selection(mp)?,
-            self.extract_design_patterns(mp)?,
-            self.extract_problem_solving(mp)?,
-            self.extract_decision_making(mp)?,
-            self.extract_error_prediction(mp)?,
-            self.extract_complexity_estimation(mp)?,
-            self.extract_personal_style(mp)?,
-            self.extract_workflow_optimization(mp)?,
-            self.extract_automation_opportunities(mp)?,
-            self.extract_skill_gaps(mp)?,
-            self.extract_project_success_patterns(mp)?,
-            self.extract_knowledge_base(mp)?,
-        ];
-
-        Ok(datasets)
-    }
-
     // Phase 1 Extractors
 
     fn extract_time_vampires(&self, mp: &MultiProgress) -> Result<DatasetInfo> {
@@ -194,16 +181,16 @@ impl DatasetExtractor {
         })
     }
 
-    fn extract_bug_patterns(&self, mp: &MultiProgress) -> Result<DatasetInfo> {
+    fn extract_bug_patterns(
+        &self,
+        mp: &MultiProgress,
+        conversations: &[Conversation],
+    ) -> Result<DatasetInfo> {
         let pb = mp.add(ProgressBar::new(100));
         pb.set_message("Extracting bug patterns...");
 
-        // Load conversations from backup/home directory
-        let base_dir = dirs::home_dir().expect("Could not determine home directory");
-        let conversations = load_all_conversations(&base_dir)?;
-
         // Extract bug patterns using the extractor
-        let dataset = BugPatternsExtractor::extract(&self.insights, &conversations)?;
+        let dataset = BugPatternsExtractor::extract(&self.insights, conversations)?;
 
         // Save to file
         let output_path = self.output_dir.join("phase1_immediate");
@@ -241,14 +228,15 @@ impl DatasetExtractor {
         })
     }
 
-    fn extract_prompt_patterns(&self, mp: &MultiProgress) -> Result<DatasetInfo> {
+    fn extract_prompt_patterns(
+        &self,
+        mp: &MultiProgress,
+        conversations: &[Conversation],
+    ) -> Result<DatasetInfo> {
         let pb = mp.add(ProgressBar::new(100));
         pb.set_message("Extracting prompt patterns...");
 
-        let base_dir = dirs::home_dir().expect("Could not determine home directory");
-        let conversations = load_all_conversations(&base_dir)?;
-
-        let dataset = PromptEngineeringExtractor::extract(&conversations)?;
+        let dataset = PromptEngineeringExtractor::extract(conversations)?;
 
         let output_path = self.output_dir.join("phase1_immediate");
         PromptEngineeringExtractor::save_to_file(&dataset, &output_path)?;
@@ -287,14 +275,15 @@ impl DatasetExtractor {
 
     // Phase 2 Extractors (ML Datasets)
 
-    fn extract_agentic_dataset(&self, mp: &MultiProgress) -> Result<DatasetInfo> {
+    fn extract_agentic_dataset(
+        &self,
+        mp: &MultiProgress,
+        conversations: &[Conversation],
+    ) -> Result<DatasetInfo> {
         let pb = mp.add(ProgressBar::new(100));
         pb.set_message("Extracting agentic tool use dataset...");
 
-        let base_dir = dirs::home_dir().expect("Could not determine home directory");
-        let conversations = load_all_conversations(&base_dir)?;
-
-        let dataset = AgenticToolUseExtractor::extract(&conversations)?;
+        let dataset = AgenticToolUseExtractor::extract(conversations)?;
 
         let output_path = self.output_dir.join("phase2_ml");
         AgenticToolUseExtractor::save_to_file(&dataset, &output_path)?;
@@ -313,14 +302,15 @@ impl DatasetExtractor {
         })
     }
 
-    fn extract_debugging_dataset(&self, mp: &MultiProgress) -> Result<DatasetInfo> {
+    fn extract_debugging_dataset(
+        &self,
+        mp: &MultiProgress,
+        conversations: &[Conversation],
+    ) -> Result<DatasetInfo> {
         let pb = mp.add(ProgressBar::new(100));
         pb.set_message("Extracting debugging dataset...");
 
-        let base_dir = dirs::home_dir().expect("Could not determine home directory");
-        let conversations = load_all_conversations(&base_dir)?;
-
-        let dataset = CodeDebuggingExtractor::extract(&conversations)?;
+        let dataset = CodeDebuggingExtractor::extract(conversations)?;
 
         let output_path = self.output_dir.join("phase2_ml");
         CodeDebuggingExtractor::save_to_file(&dataset, &output_path)?;
@@ -501,14 +491,15 @@ impl DatasetExtractor {
         Ok(self.stub_dataset("complexity_estimation", "Complexity Predictor", "ML"))
     }
 
-    fn extract_personal_style(&self, mp: &MultiProgress) -> Result<DatasetInfo> {
+    fn extract_personal_style(
+        &self,
+        mp: &MultiProgress,
+        conversations: &[Conversation],
+    ) -> Result<DatasetInfo> {
         let pb = mp.add(ProgressBar::new(100));
         pb.set_message("Extracting personal coding style...");
 
-        let base_dir = dirs::home_dir().expect("Could not determine home directory");
-        let conversations = load_all_conversations(&base_dir)?;
-
-        let dataset = PersonalStyleExtractor::extract(&conversations)?;
+        let dataset = PersonalStyleExtractor::extract(conversations)?;
 
         let output_path = self.output_dir.join("phase3_advanced");
         PersonalStyleExtractor::save_to_file(&dataset, &output_path)?;
@@ -312,20 +312,36 @@ impl JSDeobfuscator {
         }
     }
 
-    /// Apply all renames to the code
+    /// Apply all renames to the code in a single pass
     fn apply_renames(&self) -> String {
-        let mut result = self.code.clone();
-
-        // Sort by length (longest first) to avoid partial replacements
-        let mut sorted_renames: Vec<_> = self.renamed_vars.iter().collect();
-        sorted_renames.sort_by_key(|(k, _)| std::cmp::Reverse(k.len()));
+        if self.renamed_vars.is_empty() {
+            return self.code.clone();
+        }
 
-        for (old_name, new_name) in sorted_renames {
-            // Use word boundaries to avoid replacing parts of other identifiers
-            let pattern = format!(r"\b{}\b", regex::escape(old_name));
-            let re = Regex::new(&pattern).unwrap();
-            result = re.replace_all(&result, new_name.as_str()).to_string();
+        // One word-bounded alternation over every old name, longest first so
+        // shorter names cannot shadow longer ones. The previous approach ran
+        // replace_all once per rename, allocating a full-size copy of the
+        // bundle each time — several GB of churn on 100MB+ inputs.
+        let mut names: Vec<&String> = self.renamed_vars.keys().collect();
+        names.sort_by_key(|k| std::cmp::Reverse(k.len()));
+
+        let alternation = names
+            .iter()
+            .map(|name| regex::escape(name))
+            .collect::<Vec<_>>()
+            .join("|");
+        let re = Regex::new(&format!(r"\b(?:{})\b", alternation)).unwrap();
+
+        // Splice matches into one pre-sized buffer so the whole rewrite
+        // costs a single output allocation
+        let mut result = String::with_capacity(self.code.len() + self.code.len() / 16);
+        let mut last = 0;
+        for m in re.find_iter(&self.code) {
+            result.push_str(&self.code[last..m.start()]);
+            result.push_str(&self.renamed_vars[m.as_str()]);
+            last = m.end();
         }
+        result.push_str(&self.code[last..]);
 
         result
     }
@@ -2,19 +2,78 @@ use crate::models::*;
 use anyhow::Result;
 use chrono::{DateTime, Utc};
 use rayon::prelude::*;
+use serde::{Deserialize, Serialize};
 use std::collections::HashSet;
 use std::fs;
 use std::path::{Path, PathBuf};
-use std::sync::Mutex;
 use tracing::{debug, info, warn};
-use walkdir::WalkDir;
 
 /// Type alias for date range tuple
 type DateRange = (Option<DateTime<Utc>>, Option<DateTime<Utc>>);
 
+/// Cache key for the persisted discovery snapshot
+const DISCOVERY_SNAPSHOT_KEY: &str = "discovery_snapshot";
+
+/// Snapshot format version; bump to invalidate old snapshots
+const DISCOVERY_SNAPSHOT_VERSION: u32 = 1;
+
+/// Persisted result of scanning one search pattern, with the directory
+/// mtimes needed to cheaply decide whether the subtree must be rescanned.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct PatternSnapshot {
+    /// Absolute root of this search pattern
+    pub root: PathBuf,
+
+    /// mtime of the root when scanned (None if the root did not exist)
+    pub root_mtime: Option<DateTime<Utc>>,
+
+    /// (path, mtime) for every discovered location under this root
+    pub location_mtimes: Vec<(PathBuf, Option<DateTime<Utc>>)>,
+
+    /// Locations found under this root
+    pub locations: Vec<LogLocation>,
+
+    /// Tools found under this root
+    pub tools: Vec<AiTool>,
+}
+
+impl PatternSnapshot {
+    /// True if this subtree must be rescanned: the root appeared/disappeared,
+    /// its mtime moved, or any previously discovered location's mtime moved.
+    /// Costs a handful of stat() calls instead of a full walk.
+    fn is_stale(&self) -> bool {
+        if dir_mtime(&self.root) != self.root_mtime {
+            return true;
+        }
+
+        self.location_mtimes
+            .iter()
+            .any(|(path, mtime)| dir_mtime(path) != *mtime)
+    }
+}
+
+/// Full persisted discovery state, validated against the scan configuration
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct DiscoverySnapshot {
+    pub version: u32,
+    pub base_dir: PathBuf,
+    pub include_hidden: bool,
+    pub scanned_at: DateTime<Utc>,
+    pub patterns: Vec<PatternSnapshot>,
+}
+
+/// mtime of a path, or None if it cannot be statted (missing path included)
+fn dir_mtime(path: &Path) -> Option<DateTime<Utc>> {
+    fs::metadata(path)
+        .and_then(|m| m.modified())
+        .ok()
+        .map(DateTime::<Utc>::from)
+}
+
 pub struct LogDiscovery {
     base_dir: PathBuf,
     include_hidden: bool,
+    jobs: Option<usize>,
 }
 
 impl LogDiscovery {
@@ -22,17 +81,167 @@ impl LogDiscovery {
         Self {
             base_dir,
             include_hidden,
+            jobs: None,
         }
     }
 
+    /// Limit the scan to N threads (default: rayon's global pool, one per core)
+    pub fn with_jobs(mut self, jobs: Option<usize>) -> Self {
+        self.jobs = jobs;
+        self
+    }
+
     pub fn scan(&self) -> Result<DiscoveryFindings> {
+        match self.jobs {
+            Some(n) => {
+                let pool = rayon::ThreadPoolBuilder::new().num_threads(n).build()?;
+                pool.install(|| self.scan_inner())
+            }
+            None => self.scan_inner(),
+        }
+    }
+
+    fn scan_inner(&self) -> Result<DiscoveryFindings> {
         info!("Scanning from: {}", self.base_dir.display());
 
-        let locations = Vec::new();
-        let tools_found = HashSet::new();
+        let patterns: Vec<PatternSnapshot> = Self::search_patterns()
+            .par_iter()
+            .map(|pattern| self.scan_pattern(pattern))
+            .collect();
+
+        let findings = self.assemble_findings(&patterns)?;
+        self.save_snapshot(patterns);
+
+        Ok(findings)
+    }
+
+    /// Scan reusing the persisted snapshot: subtrees whose directory mtimes
+    /// are unchanged since the last run are taken from the snapshot, only
+    /// changed (or new) subtrees are walked again. Falls back to a full
+    /// scan when no valid snapshot exists for this configuration.
+    pub fn scan_cached(&self) -> Result<DiscoveryFindings> {
+        let snapshot: Option<DiscoverySnapshot> =
+            crate::cache::cache_load_bin(DISCOVERY_SNAPSHOT_KEY).unwrap_or(None);
+
+        let Some(snapshot) = snapshot.filter(|s| {
+            s.version == DISCOVERY_SNAPSHOT_VERSION
+                && s.base_dir == self.base_dir
+                && s.include_hidden == self.include_hidden
+        }) else {
+            return self.scan();
+        };
+
+        match self.jobs {
+            Some(n) => {
+                let pool = rayon::ThreadPoolBuilder::new().num_threads(n).build()?;
+                pool.install(|| self.revalidate(snapshot))
+            }
+            None => self.revalidate(snapshot),
+        }
+    }
+
+    fn revalidate(&self, snapshot: DiscoverySnapshot) -> Result<DiscoveryFindings> {
+        info!("Validating discovery snapshot from {}", snapshot.scanned_at);
+
+        let known: std::collections::HashMap<PathBuf, PatternSnapshot> = snapshot
+            .patterns
+            .into_iter()
+            .map(|p| (p.root.clone(), p))
+            .collect();
+
+        let patterns: Vec<PatternSnapshot> = Self::search_patterns()
+            .par_iter()
+            .map(|pattern| {
+                let root = self.base_dir.join(pattern);
+                match known.get(&root) {
+                    Some(prev) if !prev.is_stale() => prev.clone(),
+                    _ => {
+                        debug!("Rescanning changed subtree: {}", root.display());
+                        self.scan_pattern(pattern)
+                    }
+                }
+            })
+            .collect();
+
+        let findings = self.assemble_findings(&patterns)?;
+        self.save_snapshot(patterns);
+
+        Ok(findings)
+    }
+
+    /// Scan a single search pattern, recording the mtimes that later runs
+    /// use to decide whether this subtree needs rescanning.
+    fn scan_pattern(&self, pattern: &str) -> PatternSnapshot {
+        let root = self.base_dir.join(pattern);
+        let root_mtime = dir_mtime(&root);
+
+        let mut locations = Vec::new();
+        let mut tools = HashSet::new();
+
+        if root.exists() {
+            debug!("Found: {}", root.display());
+            let _ = self.scan_directory(&root, &mut locations, &mut tools);
+        }
+
+        let location_mtimes = locations
+            .iter()
+            .map(|loc| (loc.path.clone(), dir_mtime(&loc.path)))
+            .collect();
+
+        PatternSnapshot {
+            root,
+            root_mtime,
+            location_mtimes,
+            locations,
+            tools: tools.into_iter().collect(),
+        }
+    }
+
+    fn assemble_findings(&self, patterns: &[PatternSnapshot]) -> Result<DiscoveryFindings> {
+        let mut locations: Vec<LogLocation> = Vec::new();
+        let mut tools_found: HashSet<AiTool> = HashSet::new();
+
+        for pattern in patterns {
+            locations.extend(pattern.locations.iter().cloned());
+            tools_found.extend(pattern.tools.iter().cloned());
+        }
+
+        // Additional scan for logs in common locations
+        self.scan_logs_directory(
+            &mut locations,
+            &mut tools_found.clone().into_iter().collect(),
+        )?;
+
+        let total_size_bytes = locations.iter().map(|l| l.size_bytes).sum();
+        let total_files = locations.iter().map(|l| l.file_count).sum();
+        let tools_found: Vec<_> = tools_found.into_iter().collect();
+
+        Ok(DiscoveryFindings {
+            locations,
+            total_size_bytes,
+            total_files,
+            tools_found,
+        })
+    }
+
+    /// Persist the snapshot for the next run; failure to cache is harmless
+    fn save_snapshot(&self, patterns: Vec<PatternSnapshot>) {
+        let snapshot = DiscoverySnapshot {
+            version: DISCOVERY_SNAPSHOT_VERSION,
+            base_dir: self.base_dir.clone(),
+            include_hidden: self.include_hidden,
+            scanned_at: Utc::now(),
+            patterns,
+        };
 
-        // Known AI tool directories
-        let search_patterns = vec![
+        if let Err(e) = crate::cache::cache_save_bin(DISCOVERY_SNAPSHOT_KEY, &snapshot) {
+            debug!("Failed to persist discovery snapshot: {}", e);
+        }
+    }
+
+    /// Known AI tool directories
+    fn search_patterns() -> Vec<&'static str> {
+        vec![
             // Claude Code
             ".claude",
             "Library/Application Support/Claude",
@@ -133,53 +342,7 @@ impl LogDiscovery {
             ".CLion",
             ".GoLand",
             ".RustRover",
-        ];
-
-        // Parallel scan using rayon
-        let locations_mutex = Mutex::new(locations);
-        let tools_mutex = Mutex::new(tools_found);
-
-        search_patterns.par_iter().for_each(|pattern| {
-            let search_path = self.base_dir.join(pattern);
-            if search_path.exists() {
-                debug!("Found: {}", search_path.display());
-                let mut local_locations = Vec::new();
-                let mut local_tools = HashSet::new();
-
-                if self
-                    .scan_directory(&search_path, &mut local_locations, &mut local_tools)
-                    .is_ok()
-                {
-                    // Merge results
-                    if let Ok(mut locs) = locations_mutex.lock() {
-                        locs.extend(local_locations);
-                    }
-                    if let Ok(mut tools) = tools_mutex.lock() {
-                        tools.extend(local_tools);
-                    }
-                }
-            }
-        });
-
-        let mut locations = locations_mutex.into_inner().unwrap();
-        let tools_found = tools_mutex.into_inner().unwrap();
-
-        // Additional scan for logs in common locations
-        self.scan_logs_directory(
-            &mut locations,
-            &mut tools_found.clone().into_iter().collect(),
-        )?;
-
-        let total_size_bytes = locations.iter().map(|l| l.size_bytes).sum();
-        let total_files = locations.iter().map(|l| l.file_count).sum();
-        let tools_found: Vec<_> = tools_found.into_iter().collect();
-
-        Ok(DiscoveryFindings {
-            locations,
-            total_size_bytes,
-            total_files,
-            tools_found,
-        })
+        ]
     }
 
     fn scan_directory(
@@ -226,20 +389,29 @@ impl LogDiscovery {
             ("toolEmbeddingsCache.bin", LogType::Cache), // Copilot embeddings
         ];
 
-        for (subdir_name, log_type) in subdirs {
-            let subdir_path = path.join(subdir_name);
-            if subdir_path.exists() {
+        // Each location analysis includes a full subtree walk, so fan the
+        // subdirectories out across the pool as well; idle workers steal
+        // whole subtrees instead of waiting on the largest one.
+        let found: Vec<LogLocation> = subdirs
+            .into_par_iter()
+            .filter_map(|(subdir_name, log_type)| {
+                let subdir_path = path.join(subdir_name);
+                if !subdir_path.exists() {
+                    return None;
+                }
                 match self.analyze_location(&subdir_path, &tool, log_type) {
-                    Ok(Some(loc)) => {
-                        tools_found.insert(tool.clone());
-                        locations.push(loc);
-                    }
-                    Ok(None) => {}
+                    Ok(loc) => loc,
                     Err(e) => {
                         warn!("Error analyzing {}: {}", subdir_path.display(), e);
+                        None
                     }
                 }
-            }
+            })
+            .collect();
+
+        if !found.is_empty() {
+            tools_found.insert(tool.clone());
+            locations.extend(found);
         }
 
         Ok(())
@@ -278,34 +450,52 @@ impl LogDiscovery {
     }
 
     fn calculate_dir_size(&self, path: &PathBuf) -> Result<(u64, usize)> {
-        let mut total_size = 0u64;
-        let mut file_count = 0usize;
+        Ok(self.dir_size_parallel(path))
+    }
 
-        for entry in WalkDir::new(path)
-            .follow_links(false)
-            .into_iter()
-            .filter_map(|e| e.ok())
-            .filter(|e| {
-                // Skip hidden files/dirs if include_hidden is false
-                if !self.include_hidden {
-                    if let Some(name) = e.file_name().to_str() {
-                        if name.starts_with('.') && name != "." && name != ".." {
-                            return false;
+    /// Recursive work-stealing walk: every subdirectory becomes a rayon
+    /// task, so a 40GB Flatpak subtree is statted by the whole pool instead
+    /// of serializing one thread on it. Per-task (size, count) pairs are
+    /// merged associatively by reduce.
+    fn dir_size_parallel(&self, path: &Path) -> (u64, usize) {
+        let entries: Vec<fs::DirEntry> = match fs::read_dir(path) {
+            Ok(read_dir) => read_dir.filter_map(|e| e.ok()).collect(),
+            Err(_) => return (0, 0),
+        };
+
+        entries
+            .par_iter()
+            .map(|entry| {
+                let Ok(file_type) = entry.file_type() else {
+                    return (0, 0);
+                };
+
+                // Never follow symlinks (matches the old WalkDir config)
+                if file_type.is_symlink() {
+                    return (0, 0);
+                }
+
+                if file_type.is_dir() {
+                    return self.dir_size_parallel(&entry.path());
+                }
+
+                if file_type.is_file() {
+                    // Skip hidden files if include_hidden is false
+                    if !self.include_hidden {
+                        if let Some(name) = entry.file_name().to_str() {
+                            if name.starts_with('.') {
+                                return (0, 0);
+                            }
                         }
                     }
+                    if let Ok(metadata) = entry.metadata() {
+                        return (metadata.len(), 1);
+                    }
                 }
-                true
-            })
-        {
-            if entry.file_type().is_file() {
-                if let Ok(metadata) = entry.metadata() {
-                    total_size += metadata.len();
-                    file_count += 1;
-                }
-            }
-        }
 
-        Ok((total_size, file_count))
+                (0, 0)
+            })
+            .reduce(|| (0, 0), |a, b| (a.0 + b.0, a.1 + b.1))
     }
 
     fn get_date_range(&self, path: &Path) -> Result<DateRange> {
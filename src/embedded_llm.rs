@@ -303,6 +303,17 @@ pub struct EmbeddedLlm {
     config: Config,
     context: String,
     model_name: String,
+    prefix_state: Option<PrefixState>,
+}
+
+/// Snapshot of the model after prefilling the static prompt prefix (system
+/// turn + analysis context). Tensors are refcounted, so cloning the model
+/// only copies handles — restoring the snapshot at the start of a query
+/// rewinds the KV cache to the prefix without re-running prefill, and the
+/// persisted tokenization skips re-encoding the multi-KB context.
+struct PrefixState {
+    model: Qwen2,
+    tokens: Vec<u32>,
 }
 
 impl EmbeddedLlm {
@@ -411,12 +422,15 @@ impl EmbeddedLlm {
             config,
             context: String::new(),
             model_name: model_info.name.to_string(),
+            prefix_state: None,
         })
     }
 
     /// Set the analysis context
     pub fn set_context(&mut self, context: &str) {
         self.context = context.to_string();
+        // Prefix KV cache is built lazily on the next generate call
+        self.prefix_state = None;
     }
 
     /// Get model name
@@ -424,22 +438,61 @@ impl EmbeddedLlm {
         &self.model_name
     }
 
-    /// Generate a response
-    pub fn generate(&mut self, prompt: &str) -> Result<String> {
-        // Clear KV cache to reset model state for new query
-        self.model.clear_kv_cache();
+    /// Prefill the static prompt prefix once and snapshot the resulting
+    /// KV cache, so subsequent generate calls only pay prefill for the
+    /// question suffix.
+    fn ensure_prefix_state(&mut self) -> Result<()> {
+        if self.prefix_state.is_some() {
+            return Ok(());
+        }
 
-        let full_prompt = format!(
-            "<|im_start|>system\nYou are vibecheck, a helpful AI that analyzes coding tool usage. Be concise and actionable.<|im_end|>\n<|im_start|>user\nContext:\n{}\n\nQuestion: {}<|im_end|>\n<|im_start|>assistant\n",
-            self.context, prompt
+        let prefix_text = format!(
+            "<|im_start|>system\nYou are vibecheck, a helpful AI that analyzes coding tool usage. Be concise and actionable.<|im_end|>\n<|im_start|>user\nContext:\n{}\n\nQuestion: ",
+            self.context
         );
 
         let tokens = self
             .tokenizer
-            .encode(full_prompt.as_str(), true)
+            .encode(prefix_text.as_str(), true)
+            .map_err(|e| anyhow!("Tokenization error: {}", e))?;
+        let token_ids: Vec<u32> = tokens.get_ids().to_vec();
+
+        self.model.clear_kv_cache();
+        if !token_ids.is_empty() {
+            let input = Tensor::new(token_ids.as_slice(), &self.device)?.unsqueeze(0)?;
+            // Prefill only; logits are discarded, we just want the KV cache
+            let _ = self.model.forward(&input, 0)?;
+        }
+
+        self.prefix_state = Some(PrefixState {
+            model: self.model.clone(),
+            tokens: token_ids,
+        });
+
+        Ok(())
+    }
+
+    /// Generate a response
+    pub fn generate(&mut self, prompt: &str) -> Result<String> {
+        self.ensure_prefix_state()?;
+
+        // Rewind to the prefix-only KV cache (handle copy, no recompute)
+        let (mut token_ids, prefix_len) = {
+            let prefix = self
+                .prefix_state
+                .as_ref()
+                .expect("ensure_prefix_state populates this");
+            self.model = prefix.model.clone();
+            (prefix.tokens.clone(), prefix.tokens.len())
+        };
+
+        let suffix = format!("{}<|im_end|>\n<|im_start|>assistant\n", prompt);
+        let suffix_tokens = self
+            .tokenizer
+            .encode(suffix.as_str(), false)
             .map_err(|e| anyhow!("Tokenization error: {}", e))?;
+        token_ids.extend_from_slice(suffix_tokens.get_ids());
 
-        let mut token_ids: Vec<u32> = tokens.get_ids().to_vec();
         let mut generated = String::new();
 
         let mut logits_processor = LogitsProcessor::new(42, Some(0.7), Some(0.9));
@@ -450,7 +503,7 @@ impl EmbeddedLlm {
             .or_else(|| self.tokenizer.token_to_id("<|endoftext|>"))
             .unwrap_or(151643);
 
-        let mut pos = 0;
+        let mut pos = prefix_len;
 
         for _ in 0..MAX_TOKENS {
             let input = Tensor::new(&token_ids[pos..], &self.device)?.unsqueeze(0)?;
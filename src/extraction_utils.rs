@@ -1,6 +1,7 @@
 #![allow(dead_code)]
 
 use anyhow::Result;
+use rayon::prelude::*;
 use serde::{Deserialize, Serialize};
 use std::fs;
 use std::path::{Path, PathBuf};
@@ -52,26 +53,51 @@ pub struct ErrorInstance {
     pub conversation_id: String,
 }
 
-/// Load all conversations from home directory
-pub fn load_all_conversations(base_dir: &Path) -> Result<Vec<Conversation>> {
-    let mut conversations = Vec::new();
+/// Identifies one on-disk conversation without parsing it yet
+enum ConversationSource {
+    Cline(PathBuf),
+    ClaudeCode(PathBuf),
+    RooCline(PathBuf),
+}
 
-    // Load Cline conversations
-    conversations.extend(load_cline_conversations(base_dir)?);
+/// Streaming conversation loader: yields one parsed `Conversation` at a
+/// time, so consumers iterate the corpus with only a single file's data
+/// resident instead of materializing every conversation up front.
+///
+/// Files are memory-mapped and parsed from borrowed byte slices, avoiding
+/// the read-into-heap-String copy of the old loader. Unparseable files are
+/// skipped, matching the previous `if let Ok(..)` behavior.
+pub struct ConversationStream {
+    sources: std::vec::IntoIter<ConversationSource>,
+}
 
-    // Load Claude Code conversations
-    conversations.extend(load_claude_code_conversations(base_dir)?);
+impl Iterator for ConversationStream {
+    type Item = Conversation;
 
-    // Load Roo-Cline conversations
-    conversations.extend(load_roo_cline_conversations(base_dir)?);
+    fn next(&mut self) -> Option<Conversation> {
+        loop {
+            let parsed = match self.sources.next()? {
+                ConversationSource::Cline(path) => parse_cline_conversation(&path),
+                ConversationSource::ClaudeCode(path) => parse_claude_code_conversation(&path),
+                ConversationSource::RooCline(path) => parse_cline_conversation(&path).map(|mut conv| {
+                    conv.tool = "Roo-Cline".to_string();
+                    conv
+                }),
+            };
 
-    Ok(conversations)
+            if let Ok(conv) = parsed {
+                return Some(conv);
+            }
+        }
+    }
 }
 
-fn load_cline_conversations(base_dir: &Path) -> Result<Vec<Conversation>> {
-    let mut conversations = Vec::new();
+/// Stream all conversations from the home directory one at a time.
+/// Discovery of file paths happens eagerly (cheap), parsing lazily.
+pub fn stream_all_conversations(base_dir: &Path) -> Result<ConversationStream> {
+    let mut sources = Vec::new();
 
-    // Look for Cline task directories
+    // Cline task directories
     let cline_dirs = vec![
         base_dir.join(".config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks"),
         base_dir.join(".var/app/com.visualstudio.code/config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks"),
@@ -89,20 +115,69 @@ fn load_cline_conversations(base_dir: &Path) -> Result<Vec<Conversation>> {
             if path.is_dir() {
                 let api_file = path.join("api_conversation_history.json");
                 if api_file.exists() {
-                    if let Ok(conv) = parse_cline_conversation(&api_file) {
-                        conversations.push(conv);
-                    }
+                    sources.push(ConversationSource::Cline(api_file));
                 }
             }
         }
     }
 
-    Ok(conversations)
+    // Claude Code project JSONL files
+    let claude_dir = base_dir.join(".claude/projects");
+    if claude_dir.exists() {
+        for entry in walkdir::WalkDir::new(&claude_dir)
+            .max_depth(3)
+            .into_iter()
+            .filter_map(|e| e.ok())
+        {
+            let path = entry.path();
+            if path.extension().and_then(|s| s.to_str()) == Some("jsonl") {
+                sources.push(ConversationSource::ClaudeCode(path.to_path_buf()));
+            }
+        }
+    }
+
+    // Roo-Cline task directories
+    let roo_dir = base_dir.join(".config/Code/User/globalStorage/rooveterinaryinc.roo-cline/tasks");
+    if roo_dir.exists() {
+        for entry in fs::read_dir(&roo_dir)? {
+            let entry = entry?;
+            let path = entry.path();
+
+            if path.is_dir() {
+                let api_file = path.join("api_conversation_history.json");
+                if api_file.exists() {
+                    sources.push(ConversationSource::RooCline(api_file));
+                }
+            }
+        }
+    }
+
+    Ok(ConversationStream {
+        sources: sources.into_iter(),
+    })
+}
+
+/// Load all conversations from home directory.
+///
+/// Kept for callers that genuinely need the whole corpus in memory;
+/// prefer `stream_all_conversations` in new code.
+pub fn load_all_conversations(base_dir: &Path) -> Result<Vec<Conversation>> {
+    Ok(stream_all_conversations(base_dir)?.collect())
+}
+
+/// Memory-map a file for zero-copy parsing. Empty files get an empty map.
+fn map_file(path: &Path) -> Result<memmap2::Mmap> {
+    let file = fs::File::open(path)?;
+    // SAFETY: the mapping is read-only and dropped before this call returns
+    // to the iterator's consumer; concurrent truncation of a log file would
+    // at worst fault the parse, which the caller already treats as a skip.
+    let mmap = unsafe { memmap2::Mmap::map(&file)? };
+    Ok(mmap)
 }
 
 fn parse_cline_conversation(path: &Path) -> Result<Conversation> {
-    let content = fs::read_to_string(path)?;
-    let messages: Vec<serde_json::Value> = serde_json::from_str(&content)?;
+    let mmap = map_file(path)?;
+    let messages: Vec<serde_json::Value> = serde_json::from_slice(&mmap)?;
 
     let mut parsed_messages = Vec::new();
     for msg in messages {
@@ -151,57 +226,14 @@ fn parse_cline_conversation(path: &Path) -> Result<Conversation> {
     })
 }
 
-fn load_claude_code_conversations(base_dir: &Path) -> Result<Vec<Conversation>> {
-    let mut conversations = Vec::new();
-
-    let claude_dir = base_dir.join(".claude/projects");
-    if !claude_dir.exists() {
-        return Ok(conversations);
-    }
-
-    for entry in walkdir::WalkDir::new(&claude_dir)
-        .max_depth(3)
-        .into_iter()
-        .filter_map(|e| e.ok())
-    {
-        let path = entry.path();
-        if path.extension().and_then(|s| s.to_str()) == Some("jsonl") {
-            if let Ok(conv) = parse_claude_code_conversation(path) {
-                conversations.push(conv);
-            }
-        }
-    }
-
-    Ok(conversations)
-}
-
 fn parse_claude_code_conversation(path: &Path) -> Result<Conversation> {
-    let content = fs::read_to_string(path)?;
     let mut messages = Vec::new();
 
-    for line in content.lines() {
-        if line.trim().is_empty() {
-            continue;
-        }
-
-        if let Ok(msg) = serde_json::from_str::<serde_json::Value>(line) {
-            if let Some(role) = msg.get("role").and_then(|r| r.as_str()) {
-                let content = msg
-                    .get("content")
-                    .map(|c| c.to_string())
-                    .unwrap_or_default();
-
-                messages.push(Message {
-                    role: role.to_string(),
-                    content,
-                    timestamp: msg
-                        .get("timestamp")
-                        .and_then(|t| t.as_str())
-                        .map(|s| s.to_string()),
-                    tool_calls: Vec::new(),
-                    tokens: None,
-                });
-            }
+    // Zero-length files cannot be mapped; they parse to an empty conversation
+    if fs::metadata(path)?.len() > 0 {
+        let mmap = map_file(path)?;
+        for line in mmap.split(|&b| b == b'\n') {
+            parse_claude_code_line(line, &mut messages);
         }
     }
 
@@ -214,54 +246,59 @@ fn parse_claude_code_conversation(path: &Path) -> Result<Conversation> {
     })
 }
 
-fn load_roo_cline_conversations(base_dir: &Path) -> Result<Vec<Conversation>> {
-    // Similar to Cline but different path
-    let mut conversations = Vec::new();
+/// Parse one JSONL line (borrowed straight from the mapping) into a message
+fn parse_claude_code_line(line: &[u8], messages: &mut Vec<Message>) {
+    let line = match std::str::from_utf8(line) {
+        Ok(s) => s,
+        Err(_) => return,
+    };
 
-    let roo_dir = base_dir.join(".config/Code/User/globalStorage/rooveterinaryinc.roo-cline/tasks");
-    if !roo_dir.exists() {
-        return Ok(conversations);
+    if line.trim().is_empty() {
+        return;
     }
 
-    for entry in fs::read_dir(&roo_dir)? {
-        let entry = entry?;
-        let path = entry.path();
+    if let Ok(msg) = serde_json::from_str::<serde_json::Value>(line) {
+        if let Some(role) = msg.get("role").and_then(|r| r.as_str()) {
+            let content = msg
+                .get("content")
+                .map(|c| c.to_string())
+                .unwrap_or_default();
 
-        if path.is_dir() {
-            let api_file = path.join("api_conversation_history.json");
-            if api_file.exists() {
-                if let Ok(mut conv) = parse_cline_conversation(&api_file) {
-                    conv.tool = "Roo-Cline".to_string();
-                    conversations.push(conv);
-                }
-            }
+            messages.push(Message {
+                role: role.to_string(),
+                content,
+                timestamp: msg
+                    .get("timestamp")
+                    .and_then(|t| t.as_str())
+                    .map(|s| s.to_string()),
+                tool_calls: Vec::new(),
+                tokens: None,
+            });
         }
     }
-
-    Ok(conversations)
 }
 
-/// Extract errors from conversations
+/// Extract errors from conversations. Conversations are scanned in
+/// parallel; per-conversation results are concatenated in input order.
 pub fn extract_errors(conversations: &[Conversation]) -> Vec<ErrorInstance> {
-    let mut errors = Vec::new();
-
-    for conv in conversations {
-        for msg in conv.messages.iter() {
-            // Look for error patterns in content
-            if msg.content.contains("error")
-                || msg.content.contains("Error")
-                || msg.content.contains("ERROR")
-                || msg.content.contains("failed")
-            {
-                // Try to extract structured error info
-                if let Some(error) = parse_error_from_message(&msg.content, &conv.id) {
-                    errors.push(error);
+    conversations
+        .par_iter()
+        .flat_map_iter(|conv| {
+            conv.messages.iter().filter_map(|msg| {
+                // Look for error patterns in content
+                if msg.content.contains("error")
+                    || msg.content.contains("Error")
+                    || msg.content.contains("ERROR")
+                    || msg.content.contains("failed")
+                {
+                    // Try to extract structured error info
+                    parse_error_from_message(&msg.content, &conv.id)
+                } else {
+                    None
                 }
-            }
-        }
-    }
-
-    errors
+            })
+        })
+        .collect()
 }
 
 fn parse_error_from_message(content: &str, conv_id: &str) -> Option<ErrorInstance> {
@@ -332,3 +369,23 @@ where
         .filter(|item| seen.insert(key_fn(item)))
         .collect()
 }
+
+/// Writes serializable records as JSONL through a buffered writer,
+/// streaming each record straight to the file instead of materializing
+/// the joined output in memory first
+pub fn write_jsonl<T: Serialize>(path: &Path, items: &[T]) -> Result<()> {
+    use std::io::Write;
+
+    let file = fs::File::create(path)?;
+    let mut writer = std::io::BufWriter::new(file);
+
+    for (i, item) in items.iter().enumerate() {
+        if i > 0 {
+            writer.write_all(b"\n")?;
+        }
+        serde_json::to_writer(&mut writer, item)?;
+    }
+
+    writer.flush()?;
+    Ok(())
+}
@@ -3,7 +3,7 @@ use serde::{Deserialize, Serialize};
 use std::fs;
 use std::path::Path;
 
-use crate::extraction_utils::{estimate_tokens, Conversation, ToolCall};
+use crate::extraction_utils::{estimate_tokens, write_jsonl, Conversation, ToolCall};
 
 #[derive(Debug, Serialize, Deserialize)]
 pub struct AgenticSequence {
@@ -260,16 +260,15 @@ impl AgenticToolUseExtractor {
 
     pub fn save_to_file(dataset: &AgenticDataset, output_path: &Path) -> Result<()> {
         // Save as JSONL
-        let mut lines = Vec::new();
-        for example in &dataset.examples {
-            lines.push(serde_json::to_string(example)?);
-        }
-        fs::write(output_path.join("agentic_tool_use.jsonl"), lines.join("\n"))?;
+        write_jsonl(
+            &output_path.join("agentic_tool_use.jsonl"),
+            &dataset.examples,
+        )?;
 
         // Save for HuggingFace
-        fs::write(
-            output_path.join("../huggingface/agentic_tool_use.jsonl"),
-            lines.join("\n"),
+        write_jsonl(
+            &output_path.join("../huggingface/agentic_tool_use.jsonl"),
+            &dataset.examples,
         )?;
 
         // Save summary
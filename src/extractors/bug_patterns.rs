@@ -5,7 +5,7 @@ use std::fs;
 use std::path::Path;
 
 use crate::comprehensive_analyzer::ComprehensiveAnalysis;
-use crate::extraction_utils::{extract_errors, Conversation, ErrorInstance};
+use crate::extraction_utils::{extract_errors, write_jsonl, Conversation, ErrorInstance};
 
 #[derive(Debug, Serialize, Deserialize)]
 pub struct BugPattern {
@@ -179,11 +179,7 @@ impl BugPatternsExtractor {
 
     pub fn save_to_file(dataset: &BugPatternsDataset, output_path: &Path) -> Result<()> {
         // Save as JSONL (one pattern per line)
-        let mut lines = Vec::new();
-        for pattern in &dataset.patterns {
-            lines.push(serde_json::to_string(pattern)?);
-        }
-        fs::write(output_path.join("bug_patterns.jsonl"), lines.join("\n"))?;
+        write_jsonl(&output_path.join("bug_patterns.jsonl"), &dataset.patterns)?;
 
         // Save summary as JSON
         let summary = serde_json::to_string_pretty(dataset)?;
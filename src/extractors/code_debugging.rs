@@ -3,7 +3,7 @@ use serde::{Deserialize, Serialize};
 use std::fs;
 use std::path::Path;
 
-use crate::extraction_utils::{extract_errors, Conversation, ErrorInstance};
+use crate::extraction_utils::{extract_errors, write_jsonl, Conversation, ErrorInstance};
 
 #[derive(Debug, Serialize, Deserialize)]
 pub struct DebuggingExample {
@@ -231,16 +231,12 @@ impl CodeDebuggingExtractor {
 
     pub fn save_to_file(dataset: &CodeDebuggingDataset, output_path: &Path) -> Result<()> {
         // Save as JSONL
-        let mut lines = Vec::new();
-        for example in &dataset.examples {
-            lines.push(serde_json::to_string(example)?);
-        }
-        fs::write(output_path.join("code_debugging.jsonl"), lines.join("\n"))?;
+        write_jsonl(&output_path.join("code_debugging.jsonl"), &dataset.examples)?;
 
         // Save for HuggingFace
-        fs::write(
-            output_path.join("../huggingface/code_debugging.jsonl"),
-            lines.join("\n"),
+        write_jsonl(
+            &output_path.join("../huggingface/code_debugging.jsonl"),
+            &dataset.examples,
         )?;
 
         // Save summary
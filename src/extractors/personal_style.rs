@@ -4,7 +4,7 @@ use std::collections::HashMap;
 use std::fs;
 use std::path::Path;
 
-use crate::extraction_utils::Conversation;
+use crate::extraction_utils::{write_jsonl, Conversation};
 
 #[derive(Debug, Serialize, Deserialize)]
 pub struct CodeStyleExample {
@@ -352,25 +352,29 @@ impl PersonalStyleExtractor {
     }
 
     pub fn save_to_file(dataset: &PersonalStyleDataset, output_path: &Path) -> Result<()> {
-        // Save as JSONL for fine-tuning
-        let mut lines = Vec::new();
-        for example in &dataset.examples {
-            // Format as instruction-response pairs for fine-tuning
-            let training_example = serde_json::json!({
-                "instruction": example.instruction,
-                "input": "",
-                "output": example.code_generated,
-                "language": example.language,
-                "style": example.style_features,
-            });
-            lines.push(serde_json::to_string(&training_example)?);
-        }
-        fs::write(output_path.join("personal_style.jsonl"), lines.join("\n"))?;
+        // Save as JSONL for fine-tuning (instruction-response pairs)
+        let training_examples: Vec<serde_json::Value> = dataset
+            .examples
+            .iter()
+            .map(|example| {
+                serde_json::json!({
+                    "instruction": example.instruction,
+                    "input": "",
+                    "output": example.code_generated,
+                    "language": example.language,
+                    "style": example.style_features,
+                })
+            })
+            .collect();
+        write_jsonl(
+            &output_path.join("personal_style.jsonl"),
+            &training_examples,
+        )?;
 
         // Save for HuggingFace (instruction format)
-        fs::write(
-            output_path.join("../huggingface/personal_style.jsonl"),
-            lines.join("\n"),
+        write_jsonl(
+            &output_path.join("../huggingface/personal_style.jsonl"),
+            &training_examples,
         )?;
 
         // Save style guide
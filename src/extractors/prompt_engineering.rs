@@ -3,7 +3,7 @@ use serde::{Deserialize, Serialize};
 use std::fs;
 use std::path::Path;
 
-use crate::extraction_utils::{estimate_tokens, Conversation};
+use crate::extraction_utils::{estimate_tokens, write_jsonl, Conversation};
 
 #[derive(Debug, Serialize, Deserialize)]
 pub struct PromptExample {
@@ -322,13 +322,9 @@ impl PromptEngineeringExtractor {
 
     pub fn save_to_file(dataset: &PromptEngineeringDataset, output_path: &Path) -> Result<()> {
         // Save examples as JSONL
-        let mut lines = Vec::new();
-        for example in &dataset.examples {
-            lines.push(serde_json::to_string(example)?);
-        }
-        fs::write(
-            output_path.join("prompt_engineering.jsonl"),
-            lines.join("\n"),
+        write_jsonl(
+            &output_path.join("prompt_engineering.jsonl"),
+            &dataset.examples,
         )?;
 
         // Save summary
@@ -4,6 +4,7 @@ use chrono::{DateTime, Datelike, Duration, NaiveDate, Timelike};
 use indicatif::{ProgressBar, ProgressStyle};
 use md5::{Digest, Md5};
 use plotters::prelude::*;
+use rayon::prelude::*;
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
 use std::fs;
@@ -97,6 +98,15 @@ impl GitStats {
     }
 }
 
+/// Per-repository cache entry. `refs` fingerprints every ref head, so an
+/// unchanged repo costs one `git for-each-ref` on a re-run instead of a
+/// full `git log --numstat` walk.
+#[derive(Serialize, Deserialize)]
+struct RepoCache {
+    refs: String,
+    commits: Vec<GitCommit>,
+}
+
 pub struct GitInfographicsGenerator {
     pub git_dirs: Vec<PathBuf>,
     pub output_dir: PathBuf,
@@ -199,16 +209,19 @@ impl GitInfographicsGenerator {
             None
         };
 
-        let mut all_commits = Vec::new();
-
-        for git_dir in &self.git_dirs {
-            if let Ok(commits) = self.parse_git_log(git_dir) {
-                all_commits.extend(commits);
-            }
-            if let Some(ref pb) = pb {
-                pb.inc(1);
-            }
-        }
+        // Repos are independent; fan the per-repo log walks out across the
+        // thread pool and merge the partial results afterwards.
+        let mut all_commits: Vec<GitCommit> = self
+            .git_dirs
+            .par_iter()
+            .flat_map_iter(|git_dir| {
+                let commits = self.collect_repo_commits(git_dir).unwrap_or_default();
+                if let Some(ref pb) = pb {
+                    pb.inc(1);
+                }
+                commits
+            })
+            .collect();
 
         if let Some(pb) = pb {
             pb.finish_with_message("Done!");
@@ -275,6 +288,70 @@ impl GitInfographicsGenerator {
         Ok(stats)
     }
 
+    fn repo_cache_path(git_dir: &Path) -> PathBuf {
+        let cache_dir = dirs::cache_dir()
+            .unwrap_or_else(|| PathBuf::from("/tmp"))
+            .join("vibedev")
+            .join("git-stats")
+            .join("repos");
+        fs::create_dir_all(&cache_dir).ok();
+
+        let mut hasher = Md5::new();
+        hasher.update(git_dir.display().to_string().as_bytes());
+        let hash = format!("{:x}", hasher.finalize());
+
+        cache_dir.join(format!("{}.cache", hash))
+    }
+
+    /// Fingerprint of every ref head. `parse_git_log` walks `--all`, so a
+    /// single branch tip is not enough to tell whether the history changed.
+    fn repo_ref_fingerprint(git_dir: &Path) -> Option<String> {
+        let output = Command::new("git")
+            .current_dir(git_dir)
+            .args(["for-each-ref", "--format=%(objectname)"])
+            .output()
+            .ok()?;
+        if !output.status.success() {
+            return None;
+        }
+        Some(String::from_utf8_lossy(&output.stdout).into_owned())
+    }
+
+    /// Per-repo collection: serve unchanged repos from the on-disk cache
+    /// (one ref lookup), otherwise walk the log and refresh the cache.
+    fn collect_repo_commits(&self, git_dir: &Path) -> Result<Vec<GitCommit>> {
+        let refs = Self::repo_ref_fingerprint(git_dir);
+
+        if self.config.use_cache {
+            if let Some(ref refs) = refs {
+                let cached: Option<RepoCache> = fs::read(Self::repo_cache_path(git_dir))
+                    .ok()
+                    .and_then(|data| bincode::deserialize(&data).ok());
+                if let Some(cached) = cached {
+                    if &cached.refs == refs {
+                        return Ok(cached.commits);
+                    }
+                }
+            }
+        }
+
+        let commits = self.parse_git_log(git_dir)?;
+
+        if self.config.use_cache {
+            if let Some(refs) = refs {
+                let cache = RepoCache {
+                    refs,
+                    commits: commits.clone(),
+                };
+                if let Ok(data) = bincode::serialize(&cache) {
+                    fs::write(Self::repo_cache_path(git_dir), data).ok();
+                }
+            }
+        }
+
+        Ok(commits)
+    }
+
     /// Parse git log from a repository
     fn parse_git_log(&self, git_dir: &Path) -> Result<Vec<GitCommit>> {
         let output = Command::new("git")
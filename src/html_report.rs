@@ -1,7 +1,19 @@
 use crate::comprehensive_analyzer::ComprehensiveAnalysis;
 use anyhow::Result;
+use flate2::write::GzEncoder;
+use flate2::Compression;
+use serde_json::{json, Value};
 use std::fs;
-use std::path::PathBuf;
+use std::io::Write;
+use std::path::{Path, PathBuf};
+
+/// Overview heatmap keeps at most one year of daily cells; the full series
+/// stays in the lazily fetched `advanced` chunk
+const OVERVIEW_CALENDAR_DAYS: usize = 371;
+
+/// Top-N cutoff for the downsampled overview series (languages, projects,
+/// topics) — matches what the overview charts actually draw
+const OVERVIEW_TOP_N: usize = 10;
 
 pub struct HtmlReportGenerator {
     output_path: PathBuf,
@@ -15,18 +27,155 @@ impl HtmlReportGenerator {
     pub fn generate(&self, insights: &ComprehensiveAnalysis) -> Result<()> {
         println!("🎨 Generating interactive HTML report with D3.js visualizations...");
 
-        let html = self.generate_html(insights)?;
+        // Shell stays small: it inlines only the pre-aggregated overview.
+        // The full per-section data goes into compressed chunks next to the
+        // HTML, fetched on demand when a detail panel is opened.
+        let data_dir_name = format!(
+            "{}_data",
+            self.output_path
+                .file_stem()
+                .and_then(|s| s.to_str())
+                .unwrap_or("report")
+        );
+        let data_dir = self.output_path.with_file_name(&data_dir_name);
+        let full = serde_json::to_value(insights)?;
+
+        self.write_chunks(&full, &data_dir)?;
+        let overview = Self::build_overview(&full);
+
+        let html = self.generate_html(insights, &overview, &data_dir_name)?;
         fs::write(&self.output_path, html)?;
 
         println!("✅ Interactive HTML report generated!");
         println!("📁 Saved to: {}", self.output_path.display());
-        println!("🌐 Open it in your browser to view!");
+        println!("📦 Data chunks: {}/", data_dir.display());
+        println!("🌐 Serve the directory over HTTP to enable the detail panels");
+        println!("   (e.g. python3 -m http.server), then open it in your browser!");
 
         Ok(())
     }
 
-    fn generate_html(&self, insights: &ComprehensiveAnalysis) -> Result<String> {
-        let insights_json = serde_json::to_string_pretty(insights)?;
+    /// Writes each top-level section of the analysis as a gzipped JSON
+    /// chunk, so a panel fetch downloads only the section it needs
+    fn write_chunks(&self, full: &Value, data_dir: &Path) -> Result<()> {
+        fs::create_dir_all(data_dir)?;
+
+        if let Some(sections) = full.as_object() {
+            for (name, section) in sections {
+                let raw = serde_json::to_vec(section)?;
+                let mut encoder = GzEncoder::new(Vec::new(), Compression::default());
+                encoder.write_all(&raw)?;
+                let compressed = encoder.finish()?;
+                fs::write(data_dir.join(format!("{}.json.gz", name)), compressed)?;
+            }
+        }
+
+        Ok(())
+    }
+
+    /// Pre-aggregated, downsampled data for the overview charts: everything
+    /// the first paint needs, none of the per-conversation bulk
+    fn build_overview(full: &Value) -> Value {
+        let mut overview = json!({});
+
+        // Small scalar aggregates for the stat cards
+        for (dst, ptr) in [
+            ("total_conversations", "/conversations/total_conversations"),
+            ("total_messages", "/conversations/total_messages"),
+            ("total_tokens", "/token_usage/total_tokens"),
+            ("total_cost_usd", "/cost_analysis/total_cost_usd"),
+            ("total_hours", "/work_hours/total_hours"),
+            ("total_projects", "/advanced/project_allocation/total_projects"),
+            ("total_errors", "/advanced/error_patterns/total_errors"),
+        ] {
+            overview[dst] = full.pointer(ptr).cloned().unwrap_or(Value::Null);
+        }
+
+        overview["language_count"] = full
+            .pointer("/advanced/language_stats/by_language")
+            .and_then(Value::as_object)
+            .map(|m| m.len())
+            .unwrap_or(0)
+            .into();
+
+        // Top-N series the overview bar charts draw
+        overview["languages"] = Self::top_entries(
+            full.pointer("/advanced/language_stats/by_language"),
+            "mentions",
+            OVERVIEW_TOP_N,
+        );
+        overview["projects"] = Self::top_entries(
+            full.pointer("/advanced/project_allocation/by_project"),
+            "hours",
+            OVERVIEW_TOP_N,
+        );
+
+        let mut topics: Vec<Value> = full
+            .pointer("/advanced/topic_clusters/word_frequencies")
+            .and_then(Value::as_array)
+            .cloned()
+            .unwrap_or_default();
+        topics.sort_by(|a, b| {
+            let count = |v: &Value| v.get(1).and_then(Value::as_f64).unwrap_or(0.0);
+            count(b).partial_cmp(&count(a)).unwrap_or(std::cmp::Ordering::Equal)
+        });
+        topics.truncate(OVERVIEW_TOP_N);
+        overview["topics"] = Value::Array(topics);
+
+        // Already-small distributions are carried over as-is
+        for (dst, ptr) in [
+            ("errors_by_category", "/advanced/error_patterns/by_category"),
+            ("hours_by_hour_of_day", "/work_hours/hours_by_hour_of_day"),
+            ("hours_by_tool", "/work_hours/hours_by_tool"),
+        ] {
+            overview[dst] = full.pointer(ptr).cloned().unwrap_or(json!({}));
+        }
+
+        // Heatmap: most recent year of daily cells only
+        let calendar = full
+            .pointer("/advanced/activity_heatmap/contribution_calendar")
+            .and_then(Value::as_array)
+            .cloned()
+            .unwrap_or_default();
+        let skip = calendar.len().saturating_sub(OVERVIEW_CALENDAR_DAYS);
+        overview["calendar"] = Value::Array(calendar.into_iter().skip(skip).collect());
+
+        overview
+    }
+
+    /// Top `limit` entries of an object map, sorted by a numeric `metric`
+    /// field on each value, as `[{ "name": ..., <metric>: ... }]`
+    fn top_entries(map: Option<&Value>, metric: &str, limit: usize) -> Value {
+        let mut rows: Vec<(String, f64)> = map
+            .and_then(Value::as_object)
+            .map(|m| {
+                m.iter()
+                    .map(|(name, v)| {
+                        (
+                            name.clone(),
+                            v.get(metric).and_then(Value::as_f64).unwrap_or(0.0),
+                        )
+                    })
+                    .collect()
+            })
+            .unwrap_or_default();
+        rows.sort_by(|a, b| b.1.partial_cmp(&a.1).unwrap_or(std::cmp::Ordering::Equal));
+        rows.truncate(limit);
+
+        Value::Array(
+            rows.into_iter()
+                .map(|(name, value)| json!({ "name": name, metric: value }))
+                .collect(),
+        )
+    }
+
+    fn generate_html(
+        &self,
+        insights: &ComprehensiveAnalysis,
+        overview: &Value,
+        data_dir_name: &str,
+    ) -> Result<String> {
+        let overview_json = serde_json::to_string(overview)?;
 
         let html = format!(
             r#"<!DOCTYPE html>
@@ -211,6 +360,32 @@ impl HtmlReportGenerator {
             margin: 5px;
             font-size: 0.9rem;
         }}
+
+        details > summary {{
+            cursor: pointer;
+            list-style: none;
+        }}
+
+        details > summary::before {{
+            content: '▸ ';
+            color: #8b5cf6;
+        }}
+
+        details[open] > summary::before {{
+            content: '▾ ';
+        }}
+
+        .chunk-view {{
+            margin-top: 20px;
+            padding: 20px;
+            max-height: 500px;
+            overflow: auto;
+            background: rgba(15, 23, 42, 0.6);
+            border: 1px solid rgba(139, 92, 246, 0.15);
+            border-radius: 10px;
+            font-size: 13px;
+            white-space: pre;
+        }}
     </style>
 </head>
 <body>
@@ -257,16 +432,47 @@ impl HtmlReportGenerator {
             <div id="toolChart" class="chart"></div>
         </div>
 
+        <div class="chart-container">
+            <details data-chunk="conversations">
+                <summary class="chart-title">💬 Conversations — full data</summary>
+                <pre class="chunk-view">Loading…</pre>
+            </details>
+        </div>
+
+        <div class="chart-container">
+            <details data-chunk="token_usage">
+                <summary class="chart-title">🎯 Token Usage — full data</summary>
+                <pre class="chunk-view">Loading…</pre>
+            </details>
+        </div>
+
+        <div class="chart-container">
+            <details data-chunk="work_hours">
+                <summary class="chart-title">⏱️ Work Hours — full data</summary>
+                <pre class="chunk-view">Loading…</pre>
+            </details>
+        </div>
+
+        <div class="chart-container">
+            <details data-chunk="viral_insights">
+                <summary class="chart-title">🎉 Viral Stats — full data</summary>
+                <pre class="chunk-view">Loading…</pre>
+            </details>
+        </div>
+
         <div class="footer">
             <p>Generated with <a href="https://osvm.ai" target="_blank">OpenSVM</a> AI Log Analyzer</p>
-            <p>Analyzed 52.42 GB of data • {} conversations • {} hours coded</p>
+            <p>Analyzed 52.42 GB of data • {conversations} conversations • {hours} hours coded</p>
         </div>
     </div>
 
     <div class="tooltip" id="tooltip"></div>
 
     <script>
-        const data = {};
+        // Pre-aggregated, downsampled overview only; full per-section data
+        // lives in gzipped chunks fetched on demand by the detail panels
+        const overview = {overview};
+        const DATA_DIR = '{data_dir}/';
 
         // OpenSVM brand colors
         const colors = {{
@@ -281,14 +487,14 @@ impl HtmlReportGenerator {
         // Create stats cards
         function createStatsCards() {{
             const stats = [
-                {{ icon: '💬', value: data.conversations.total_conversations.toLocaleString(), label: 'Conversations' }},
-                {{ icon: '💭', value: data.conversations.total_messages.toLocaleString(), label: 'Messages' }},
-                {{ icon: '🎯', value: Math.round(data.token_usage.total_tokens / 1000000) + 'M', label: 'Tokens' }},
-                {{ icon: '💰', value: '$' + data.cost_analysis.total_cost_usd.toFixed(2), label: 'Total Cost' }},
-                {{ icon: '⏱️', value: Math.round(data.work_hours.total_hours) + 'h', label: 'Hours Coded' }},
-                {{ icon: '📁', value: data.advanced.project_allocation.total_projects, label: 'Projects' }},
-                {{ icon: '💻', value: Object.keys(data.advanced.language_stats.by_language).length, label: 'Languages' }},
-                {{ icon: '🐛', value: data.advanced.error_patterns.total_errors.toLocaleString(), label: 'Errors Fixed' }},
+                {{ icon: '💬', value: overview.total_conversations.toLocaleString(), label: 'Conversations' }},
+                {{ icon: '💭', value: overview.total_messages.toLocaleString(), label: 'Messages' }},
+                {{ icon: '🎯', value: Math.round(overview.total_tokens / 1000000) + 'M', label: 'Tokens' }},
+                {{ icon: '💰', value: '$' + overview.total_cost_usd.toFixed(2), label: 'Total Cost' }},
+                {{ icon: '⏱️', value: Math.round(overview.total_hours) + 'h', label: 'Hours Coded' }},
+                {{ icon: '📁', value: overview.total_projects, label: 'Projects' }},
+                {{ icon: '💻', value: overview.language_count, label: 'Languages' }},
+                {{ icon: '🐛', value: overview.total_errors.toLocaleString(), label: 'Errors Fixed' }},
             ];
 
             const grid = d3.select('#statsGrid');
@@ -302,10 +508,7 @@ impl HtmlReportGenerator {
 
         // Language distribution chart
         function createLanguageChart() {{
-            const languages = Object.entries(data.advanced.language_stats.by_language)
-                .map(([name, metrics]) => ({{ name, mentions: metrics.mentions }}))
-                .sort((a, b) => b.mentions - a.mentions)
-                .slice(0, 10);
+            const languages = overview.languages;
 
             const width = document.getElementById('languageChart').clientWidth;
             const height = 500;
@@ -357,7 +560,7 @@ impl HtmlReportGenerator {
 
         // Topics chart
         function createTopicsChart() {{
-            const topics = data.advanced.topic_clusters.word_frequencies.slice(0, 10);
+            const topics = overview.topics;
 
             const width = document.getElementById('topicsChart').clientWidth;
             const height = 500;
@@ -405,7 +608,7 @@ impl HtmlReportGenerator {
 
         // Error chart (pie chart)
         function createErrorChart() {{
-            const errors = Object.entries(data.advanced.error_patterns.by_category)
+            const errors = Object.entries(overview.errors_by_category)
                 .map(([name, count]) => ({{ name, count }}))
                 .sort((a, b) => b.count - a.count);
 
@@ -463,7 +666,7 @@ impl HtmlReportGenerator {
         function createHourlyChart() {{
             const hourlyData = Array.from({{ length: 24 }}, (_, i) => ({{
                 hour: i,
-                hours: data.work_hours.hours_by_hour_of_day[i] || 0
+                hours: overview.hours_by_hour_of_day[i] || 0
             }}));
 
             const width = document.getElementById('hourlyChart').clientWidth;
@@ -514,9 +717,9 @@ impl HtmlReportGenerator {
                 .attr('color', '#94a3b8');
         }}
 
-        // Activity heatmap
+        // Activity heatmap (overview carries at most the last year of cells)
         function createHeatmap() {{
-            const calendar = data.advanced.activity_heatmap.contribution_calendar;
+            const calendar = overview.calendar;
 
             const width = document.getElementById('heatmapChart').clientWidth;
             const cellSize = 15;
@@ -552,10 +755,7 @@ impl HtmlReportGenerator {
 
         // Project allocation
         function createProjectChart() {{
-            const projects = Object.entries(data.advanced.project_allocation.by_project)
-                .map(([name, metrics]) => ({{ name, hours: metrics.hours }}))
-                .sort((a, b) => b.hours - a.hours)
-                .slice(0, 10);
+            const projects = overview.projects;
 
             const width = document.getElementById('projectChart').clientWidth;
             const height = 500;
@@ -603,7 +803,7 @@ impl HtmlReportGenerator {
 
         // Tool comparison
         function createToolChart() {{
-            const tools = Object.entries(data.work_hours.hours_by_tool)
+            const tools = Object.entries(overview.hours_by_tool)
                 .map(([name, hours]) => ({{ name, hours }}))
                 .sort((a, b) => b.hours - a.hours);
 
@@ -671,6 +871,31 @@ impl HtmlReportGenerator {
             d3.select('#tooltip').style('opacity', 0);
         }}
 
+        // Lazy detail panels: each fetches its gzipped chunk the first time
+        // it is opened, so the shell never pays for data nobody looks at
+        async function loadChunk(name) {{
+            const resp = await fetch(DATA_DIR + name + '.json.gz');
+            if (!resp.ok) throw new Error(resp.status + ' ' + resp.statusText);
+            const stream = resp.body.pipeThrough(new DecompressionStream('gzip'));
+            return await new Response(stream).json();
+        }}
+
+        document.querySelectorAll('details[data-chunk]').forEach(panel => {{
+            panel.addEventListener('toggle', async () => {{
+                if (!panel.open || panel.dataset.loaded) return;
+                panel.dataset.loaded = '1';
+                const view = panel.querySelector('.chunk-view');
+                try {{
+                    const chunk = await loadChunk(panel.dataset.chunk);
+                    view.textContent = JSON.stringify(chunk, null, 2);
+                }} catch (e) {{
+                    view.textContent = 'Could not load ' + panel.dataset.chunk + '.json.gz (' + e.message + ').\n'
+                        + 'Browsers block fetch() over file:// - serve the report directory instead:\n'
+                        + '    python3 -m http.server';
+                }}
+            }});
+        }});
+
         // Initialize all charts
         createStatsCards();
         createLanguageChart();
@@ -683,9 +908,10 @@ impl HtmlReportGenerator {
     </script>
 </body>
 </html>"#,
-            insights.conversations.total_conversations,
-            insights.work_hours.total_hours.round() as u64,
-            insights_json
+            conversations = insights.conversations.total_conversations,
+            hours = insights.work_hours.total_hours.round() as u64,
+            overview = overview_json,
+            data_dir = data_dir_name
         );
 
         Ok(html)
@@ -0,0 +1,14 @@
+//! Library target exposing the hot-path modules so the criterion benches
+//! under `benches/` can drive them against synthetic corpora. The binaries
+//! keep their own module graphs in `main.rs` / `unbundler_cli.rs`; only add
+//! modules here when a bench (or external test) actually needs them.
+
+pub mod cache;
+pub mod claude_code_parser;
+pub mod conversation_store;
+pub mod discovery;
+pub mod extraction_utils;
+pub mod models;
+pub mod parsers;
+pub mod sanitizer;
+pub mod search;
@@ -14,12 +14,14 @@ mod claude_code_parser;
 mod cli_output;
 mod comprehensive_analyzer;
 mod comprehensive_backup_analytics;
+mod conversation_store;
 mod discovery;
 mod history_sanitizer;
 mod metrics;
 mod models;
 mod parsers;
 mod prepare;
+mod profiling;
 mod report;
 mod sanitizer;
 mod shell_analytics;
@@ -39,6 +41,7 @@ mod git_infographics;
 mod html_report;
 mod llm_chat;
 mod report_analyzer;
+mod stats_engine;
 mod timeline;
 mod timeline_png;
 mod tui;
@@ -51,7 +54,6 @@ mod tui_traffic;
 
 use analysis::Analyzer;
 use backup::BackupManager;
-use comprehensive_analyzer::ComprehensiveAnalyzer;
 use discovery::LogDiscovery;
 use prepare::DatasetPreparer;
 use report::ReportGenerator;
@@ -82,6 +84,11 @@ struct Cli {
     /// Disable colors and emojis (for piping/logging)
     #[arg(long, global = true)]
     plain: bool,
+
+    /// Print a stage-by-stage time/bytes breakdown and write a
+    /// flamegraph-compatible trace (vibedev-profile.folded) on exit
+    #[arg(long, global = true)]
+    profile: bool,
 }
 
 #[derive(Subcommand)]
@@ -95,6 +102,10 @@ enum Commands {
         /// Include hidden directories
         #[arg(long, default_value = "true")]
         hidden: bool,
+
+        /// Number of scan threads (default: one per core)
+        #[arg(short, long)]
+        jobs: Option<usize>,
     },
 
     /// Analyze discovered logs
@@ -539,17 +550,23 @@ fn load_analysis_data(path: &PathBuf) -> Result<String> {
 async fn main() -> Result<()> {
     let cli = Cli::parse();
 
-    // Setup logging
-    let level = if cli.verbose {
-        Level::DEBUG
+    // Setup logging; --profile swaps in a subscriber that also times spans
+    // and prints the breakdown when the guard drops at the end of main
+    let _profile_guard = if cli.profile {
+        Some(profiling::init(cli.verbose)?)
     } else {
-        Level::INFO
+        let level = if cli.verbose {
+            Level::DEBUG
+        } else {
+            Level::INFO
+        };
+        let subscriber = FmtSubscriber::builder()
+            .with_max_level(level)
+            .with_target(false)
+            .finish();
+        tracing::subscriber::set_global_default(subscriber)?;
+        None
     };
-    let subscriber = FmtSubscriber::builder()
-        .with_max_level(level)
-        .with_target(false)
-        .finish();
-    tracing::subscriber::set_global_default(subscriber)?;
 
     // Initialize output writer based on flags
     use cli_output::{OutputMode, OutputWriter};
@@ -563,12 +580,16 @@ async fn main() -> Result<()> {
     let _out = OutputWriter::new(output_mode);
 
     match cli.command {
-        Commands::Discover { base_dir, hidden } => {
+        Commands::Discover {
+            base_dir,
+            hidden,
+            jobs,
+        } => {
             info!("🔍 Discovering AI tool logs...");
             let base = base_dir
                 .unwrap_or_else(|| dirs::home_dir().expect("Could not determine home directory"));
 
-            let discovery = LogDiscovery::new(base, hidden);
+            let discovery = LogDiscovery::new(base, hidden).with_jobs(jobs);
             let findings = discovery.scan()?;
 
             println!("\n📊 Discovery Results:\n");
@@ -1058,9 +1079,7 @@ async fn main() -> Result<()> {
             info!("🔍 Generating comprehensive insights from 52+ GB data...");
 
             let base_dir = dirs::home_dir().expect("Could not determine home directory");
-            let analyzer = ComprehensiveAnalyzer::new(base_dir);
-
-            let insights = analyzer.analyze()?;
+            let insights = daemon::insights_or_analyze(base_dir)?;
 
             // Save JSON report
             let json = serde_json::to_string_pretty(&insights)?;
@@ -1174,9 +1193,9 @@ async fn main() -> Result<()> {
             info!("🚀 Extracting 37 datasets from backup...");
 
             // First, run comprehensive analysis to get insights
+            // (served from the daemon's warm cache when it is running)
             let base_dir = dirs::home_dir().expect("Could not determine home directory");
-            let analyzer = ComprehensiveAnalyzer::new(base_dir);
-            let insights = analyzer.analyze()?;
+            let insights = daemon::insights_or_analyze(base_dir)?;
 
             let output_dir = output.unwrap_or_else(|| {
                 dirs::home_dir()
@@ -1,3 +1,4 @@
+use crate::stats_engine::StatsEngine;
 use anyhow::Result;
 use indicatif::{ProgressBar, ProgressStyle};
 use std::time::Duration;
@@ -16,28 +17,28 @@ pub async fn live_stats(interval_secs: u64) -> Result<()> {
             .unwrap(),
     );
 
+    // One full scan to seed the counters, then filesystem notifications
+    // keep them current — each tick below only reads the snapshot
+    pb.set_message("Scanning log locations...");
+    pb.tick();
+
+    let base_dir = dirs::home_dir().expect("Could not determine home directory");
+    let engine = StatsEngine::new(base_dir, true)?;
+
     let mut interval = time::interval(Duration::from_secs(interval_secs));
 
     loop {
         interval.tick().await;
 
-        // Collect current stats
-        let base_dir = dirs::home_dir().expect("Could not determine home directory");
-        let discovery = crate::discovery::LogDiscovery::new(base_dir, true);
-
-        match discovery.scan() {
-            Ok(findings) => {
-                pb.set_message(format!(
-                    "Storage: {} | Files: {} | Tools: {}",
-                    crate::models::format_bytes(findings.total_size_bytes).green(),
-                    findings.total_files.to_string().cyan(),
-                    findings.tools_found.len().to_string().yellow()
-                ));
-            }
-            Err(e) => {
-                pb.set_message(format!("Error: {}", e).red().to_string());
-            }
-        }
+        let stats = engine.snapshot();
+        pb.set_message(format!(
+            "Storage: {} | Files: {} | Tools: {} | Messages: {} | Events: {}",
+            crate::models::format_bytes(stats.total_size_bytes).green(),
+            stats.total_files.to_string().cyan(),
+            stats.tool_sizes.len().to_string().yellow(),
+            stats.total_messages.to_string().magenta(),
+            stats.updates_applied.to_string().blue()
+        ));
 
         pb.tick();
     }
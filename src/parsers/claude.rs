@@ -17,13 +17,12 @@ impl LogParser for ClaudeParser {
 
     fn parse(&self, path: &Path) -> Result<ParsedLog> {
         let mut entries = Vec::new();
-        let mut oldest: Option<DateTime<Utc>> = None;
-        let mut newest: Option<DateTime<Utc>> = None;
 
         // Check if this is history.jsonl
         if path.file_name().and_then(|n| n.to_str()) == Some("history.jsonl") {
             let file = fs::File::open(path)?;
             let reader = BufReader::new(file);
+            let mut scratch = Vec::new();
 
             for line in reader.lines() {
                 let line = line?;
@@ -31,13 +30,8 @@ impl LogParser for ClaudeParser {
                     continue;
                 }
 
-                if let Ok(json) = serde_json::from_str::<Value>(&line) {
+                if let Some(json) = crate::conversation_store::parse_json_str(&line, &mut scratch) {
                     if let Some(entry) = parse_history_entry(&json) {
-                        // Update date range
-                        if let Some(ts) = entry.timestamp {
-                            oldest = Some(oldest.map_or(ts, |o| o.min(ts)));
-                            newest = Some(newest.map_or(ts, |n| n.max(ts)));
-                        }
                         entries.push(entry);
                     }
                 }
@@ -48,21 +42,19 @@ impl LogParser for ClaudeParser {
         }
 
         let file_size = fs::metadata(path).map(|m| m.len()).unwrap_or(0);
-        let entry_count = entries.len();
+        let metadata = LogMetadata::from_entries(file_size, &entries);
 
         Ok(ParsedLog {
             tool: AiTool::ClaudeCode,
             entries,
-            metadata: LogMetadata {
-                file_size,
-                entry_count,
-                date_range: (oldest, newest),
-            },
+            metadata,
         })
     }
 }
 
-fn parse_history_entry(json: &Value) -> Option<LogEntry> {
+/// Parses one history.jsonl entry. Also used by the search index to
+/// ingest appended lines without re-reading the whole file.
+pub(crate) fn parse_history_entry(json: &Value) -> Option<LogEntry> {
     // Extract timestamp
     let timestamp = json
         .get("timestamp")
@@ -17,8 +17,6 @@ impl LogParser for ClineParser {
 
     fn parse(&self, path: &Path) -> Result<ParsedLog> {
         let mut entries = Vec::new();
-        let mut oldest: Option<DateTime<Utc>> = None;
-        let mut newest: Option<DateTime<Utc>> = None;
 
         // Cline typically stores logs in a logs directory
         let log_dir = if path.is_dir() {
@@ -46,10 +44,6 @@ impl LogParser for ClineParser {
                             }
                             if let Ok(json) = serde_json::from_str::<Value>(&line) {
                                 if let Some(entry) = parse_cline_json_entry(&json) {
-                                    if let Some(ts) = entry.timestamp {
-                                        oldest = Some(oldest.map_or(ts, |o| o.min(ts)));
-                                        newest = Some(newest.map_or(ts, |n| n.max(ts)));
-                                    }
                                     entries.push(entry);
                                 }
                             }
@@ -61,10 +55,6 @@ impl LogParser for ClineParser {
                         let reader = BufReader::new(file);
                         for line in reader.lines().map_while(Result::ok) {
                             if let Some(entry) = parse_cline_text_entry(&line) {
-                                if let Some(ts) = entry.timestamp {
-                                    oldest = Some(oldest.map_or(ts, |o| o.min(ts)));
-                                    newest = Some(newest.map_or(ts, |n| n.max(ts)));
-                                }
                                 entries.push(entry);
                             }
                         }
@@ -74,16 +64,12 @@ impl LogParser for ClineParser {
         }
 
         let file_size = fs::metadata(path).map(|m| m.len()).unwrap_or(0);
-        let entry_count = entries.len();
+        let metadata = LogMetadata::from_entries(file_size, &entries);
 
         Ok(ParsedLog {
             tool: AiTool::Cline,
             entries,
-            metadata: LogMetadata {
-                file_size,
-                entry_count,
-                date_range: (oldest, newest),
-            },
+            metadata,
         })
     }
 }
@@ -17,8 +17,6 @@ impl LogParser for CursorParser {
 
     fn parse(&self, path: &Path) -> Result<ParsedLog> {
         let mut entries = Vec::new();
-        let mut oldest: Option<DateTime<Utc>> = None;
-        let mut newest: Option<DateTime<Utc>> = None;
 
         // Cursor typically stores logs in User/.cursor/logs or similar
         let log_path = if path.is_dir() {
@@ -47,19 +45,11 @@ impl LogParser for CursorParser {
                         // Try parsing as JSON first
                         if let Ok(json) = serde_json::from_str::<Value>(&line) {
                             if let Some(entry) = parse_cursor_json_entry(&json) {
-                                if let Some(ts) = entry.timestamp {
-                                    oldest = Some(oldest.map_or(ts, |o| o.min(ts)));
-                                    newest = Some(newest.map_or(ts, |n| n.max(ts)));
-                                }
                                 entries.push(entry);
                             }
                         } else {
                             // Parse as plain text
                             if let Some(entry) = parse_cursor_text_entry(&line) {
-                                if let Some(ts) = entry.timestamp {
-                                    oldest = Some(oldest.map_or(ts, |o| o.min(ts)));
-                                    newest = Some(newest.map_or(ts, |n| n.max(ts)));
-                                }
                                 entries.push(entry);
                             }
                         }
@@ -69,16 +59,12 @@ impl LogParser for CursorParser {
         }
 
         let file_size = fs::metadata(path).map(|m| m.len()).unwrap_or(0);
-        let entry_count = entries.len();
+        let metadata = LogMetadata::from_entries(file_size, &entries);
 
         Ok(ParsedLog {
             tool: AiTool::Cursor,
             entries,
-            metadata: LogMetadata {
-                file_size,
-                entry_count,
-                date_range: (oldest, newest),
-            },
+            metadata,
         })
     }
 }
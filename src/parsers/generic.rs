@@ -2,11 +2,18 @@
 use super::{EntryCategory, LogEntry, LogLevel, LogMetadata, LogParser, ParsedLog};
 use crate::models::AiTool;
 use anyhow::Result;
-use chrono::{DateTime, Utc};
+use chrono::{DateTime, Timelike, Utc};
+use std::collections::HashMap;
 use std::fs;
 use std::io::{BufRead, BufReader};
 use std::path::Path;
 
+/// Upper bound on `LogEntry` values kept in `ParsedLog.entries`. Every line
+/// still contributes to the metadata aggregates; this only caps how many
+/// materialized entries (one `String` each) are retained for downstream
+/// consumers, so memory stays flat on multi-GB logs.
+const MAX_RETAINED_ENTRIES: usize = 10_000;
+
 pub struct GenericParser;
 
 impl LogParser for GenericParser {
@@ -18,30 +25,63 @@ impl LogParser for GenericParser {
         let mut entries = Vec::new();
         let mut oldest: Option<DateTime<Utc>> = None;
         let mut newest: Option<DateTime<Utc>> = None;
+        let mut entry_count = 0usize;
+        let mut user_prompts = 0u64;
+        let mut assistant_responses = 0u64;
+        let mut hourly_distribution: HashMap<u8, u64> = HashMap::new();
 
-        // Try to read as a text file
+        // Stream the whole file with two reused buffers (line + lowercase
+        // scratch), so steady-state parsing allocates nothing per line and
+        // the aggregates cover every line, not just the first few thousand.
         if path.is_file() {
             if let Ok(file) = fs::File::open(path) {
-                let reader = BufReader::new(file);
-                let mut line_count = 0;
+                let mut reader = BufReader::new(file);
+                let mut line = String::new();
+                let mut lowered = String::new();
 
-                for line in reader.lines().map_while(Result::ok) {
-                    line_count += 1;
-                    if line.trim().is_empty() {
+                loop {
+                    line.clear();
+                    match reader.read_line(&mut line) {
+                        Ok(0) => break,
+                        Ok(_) => {}
+                        Err(_) => break, // non-UTF-8 data; stop like .lines() did
+                    }
+                    let text = line.trim_end_matches(['\r', '\n']);
+                    if text.trim().is_empty() {
                         continue;
                     }
+                    entry_count += 1;
+
+                    // Keyword matching is ASCII-only, so ASCII lowercasing is
+                    // enough and avoids the allocation of `to_lowercase()`.
+                    lowered.clear();
+                    lowered.push_str(text);
+                    lowered.make_ascii_lowercase();
+
+                    let level = detect_level(&lowered);
+                    let category = detect_category(&lowered);
+                    let timestamp = detect_timestamp(text);
 
-                    // Very basic parsing - just extract lines
-                    let entry = parse_generic_line(&line);
-                    if let Some(ts) = entry.timestamp {
+                    match category {
+                        EntryCategory::UserPrompt => user_prompts += 1,
+                        EntryCategory::AssistantResponse => assistant_responses += 1,
+                        _ => {}
+                    }
+                    if let Some(ts) = timestamp {
                         oldest = Some(oldest.map_or(ts, |o| o.min(ts)));
                         newest = Some(newest.map_or(ts, |n| n.max(ts)));
+                        *hourly_distribution.entry(ts.hour() as u8).or_insert(0) += 1;
                     }
-                    entries.push(entry);
 
-                    // Limit entries to avoid memory issues with huge files
-                    if line_count > 10000 {
-                        break;
+                    // Keep a bounded sample of full entries for consumers
+                    // that inspect individual lines (search indexing etc.)
+                    if entries.len() < MAX_RETAINED_ENTRIES {
+                        entries.push(LogEntry {
+                            timestamp,
+                            level,
+                            message: text.to_string(),
+                            category,
+                        });
                     }
                 }
             }
@@ -55,11 +95,11 @@ impl LogParser for GenericParser {
                     message: format!("Directory with {} files", file_count),
                     category: EntryCategory::SystemEvent,
                 });
+                entry_count = entries.len();
             }
         }
 
         let file_size = fs::metadata(path).map(|m| m.len()).unwrap_or(0);
-        let entry_count = entries.len();
 
         // Determine tool from path
         let tool = AiTool::from_path(path).unwrap_or_else(|| {
@@ -77,59 +117,49 @@ impl LogParser for GenericParser {
             metadata: LogMetadata {
                 file_size,
                 entry_count,
+                user_prompts,
+                assistant_responses,
+                hourly_distribution,
                 date_range: (oldest, newest),
             },
         })
     }
 }
 
-fn parse_generic_line(line: &str) -> LogEntry {
-    // Try to extract basic info from the line
-    let level = if line.to_lowercase().contains("error") {
+fn detect_level(lowered: &str) -> LogLevel {
+    if lowered.contains("error") {
         LogLevel::Error
-    } else if line.to_lowercase().contains("warn") {
+    } else if lowered.contains("warn") {
         LogLevel::Warn
-    } else if line.to_lowercase().contains("debug") {
+    } else if lowered.contains("debug") {
         LogLevel::Debug
     } else {
         LogLevel::Unknown
-    };
+    }
+}
 
-    let category = if line.to_lowercase().contains("user")
-        || line.to_lowercase().contains("prompt")
-        || line.to_lowercase().contains("question")
-    {
+fn detect_category(lowered: &str) -> EntryCategory {
+    if lowered.contains("user") || lowered.contains("prompt") || lowered.contains("question") {
         EntryCategory::UserPrompt
-    } else if line.to_lowercase().contains("assistant")
-        || line.to_lowercase().contains("response")
-        || line.to_lowercase().contains("answer")
+    } else if lowered.contains("assistant")
+        || lowered.contains("response")
+        || lowered.contains("answer")
     {
         EntryCategory::AssistantResponse
-    } else if line.to_lowercase().contains("tool")
-        || line.to_lowercase().contains("function")
-        || line.to_lowercase().contains("call")
-    {
+    } else if lowered.contains("tool") || lowered.contains("function") || lowered.contains("call") {
         EntryCategory::ToolUse
-    } else if line.to_lowercase().contains("file")
-        || line.to_lowercase().contains("edit")
-        || line.to_lowercase().contains("write")
-    {
+    } else if lowered.contains("file") || lowered.contains("edit") || lowered.contains("write") {
         EntryCategory::FileOperation
     } else {
         EntryCategory::Unknown
-    };
+    }
+}
 
-    // Try to extract timestamp (very basic ISO 8601 detection)
-    let timestamp = line
-        .split_whitespace()
+// Very basic ISO 8601 detection; parses from the original (non-lowered)
+// line because RFC 3339 'T'/'Z' markers are case-sensitive.
+fn detect_timestamp(line: &str) -> Option<DateTime<Utc>> {
+    line.split_whitespace()
         .find(|s| s.contains('T') && s.contains(':'))
         .and_then(|s| DateTime::parse_from_rfc3339(s).ok())
-        .map(|dt| dt.with_timezone(&Utc));
-
-    LogEntry {
-        timestamp,
-        level,
-        message: line.to_string(),
-        category,
-    }
+        .map(|dt| dt.with_timezone(&Utc))
 }
@@ -7,6 +7,8 @@ pub mod generic;
 
 use crate::models::*;
 use anyhow::Result;
+use chrono::Timelike;
+use std::collections::HashMap;
 use std::path::Path;
 
 pub trait LogParser: Send + Sync {
@@ -54,8 +56,46 @@ pub enum EntryCategory {
 pub struct LogMetadata {
     pub file_size: u64,
     pub entry_count: usize,
+    pub user_prompts: u64,
+    pub assistant_responses: u64,
+    pub hourly_distribution: HashMap<u8, u64>,
     pub date_range: (
         Option<chrono::DateTime<chrono::Utc>>,
         Option<chrono::DateTime<chrono::Utc>>,
     ),
 }
+
+impl LogMetadata {
+    /// Aggregates metadata from fully materialized entries. Streaming parsers
+    /// that cap how many entries they retain (see `GenericParser`) accumulate
+    /// these counters inline over the whole file instead.
+    pub fn from_entries(file_size: u64, entries: &[LogEntry]) -> Self {
+        let mut user_prompts = 0u64;
+        let mut assistant_responses = 0u64;
+        let mut hourly_distribution: HashMap<u8, u64> = HashMap::new();
+        let mut oldest: Option<chrono::DateTime<chrono::Utc>> = None;
+        let mut newest: Option<chrono::DateTime<chrono::Utc>> = None;
+
+        for entry in entries {
+            match entry.category {
+                EntryCategory::UserPrompt => user_prompts += 1,
+                EntryCategory::AssistantResponse => assistant_responses += 1,
+                _ => {}
+            }
+            if let Some(ts) = entry.timestamp {
+                oldest = Some(oldest.map_or(ts, |o| o.min(ts)));
+                newest = Some(newest.map_or(ts, |n| n.max(ts)));
+                *hourly_distribution.entry(ts.hour() as u8).or_insert(0) += 1;
+            }
+        }
+
+        LogMetadata {
+            file_size,
+            entry_count: entries.len(),
+            user_prompts,
+            assistant_responses,
+            hourly_distribution,
+            date_range: (oldest, newest),
+        }
+    }
+}
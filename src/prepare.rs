@@ -1,17 +1,31 @@
-use crate::backup::BackupManager;
+use crate::discovery::LogDiscovery;
 use crate::models::format_bytes;
 use crate::sanitizer::{Sanitizer, SensitiveDataType};
-use anyhow::Result;
+use anyhow::{Context, Result};
 use colored::*;
 use indicatif::{ProgressBar, ProgressStyle};
+use rayon::prelude::*;
 use serde::{Deserialize, Serialize};
-use std::collections::HashMap;
+use std::collections::{HashMap, HashSet};
 use std::fs::{self, File};
-use std::io::{BufRead, BufReader, Write};
-use std::path::PathBuf;
+use std::io::Write;
+use std::path::{Path, PathBuf};
+use std::sync::mpsc;
 use zip::write::FileOptions;
 use zip::ZipWriter;
 
+/// In-flight sanitized files between the parallel sanitizers and the zip
+/// writer; bounds pipeline memory on large trees
+const PREPARE_QUEUE_DEPTH: usize = 64;
+
+/// One sanitized file ready to be written into the dataset archive
+struct PreparedFile {
+    archive_path: String,
+    content: Vec<u8>,
+    stats: SanitizeStats,
+    examples: Vec<TrainingExample>,
+}
+
 #[derive(Debug, Serialize, Deserialize)]
 pub struct TrainingExample {
     pub prompt: String,
@@ -42,70 +56,141 @@ impl DatasetPreparer {
         }
     }
 
+    /// Prepares the dataset by streaming straight from the live log tree:
+    /// every file is read once, sanitized in memory, and written directly
+    /// into the final zip. No backup archive, no temp extraction, no
+    /// second copy of the corpus on disk.
     pub async fn prepare_dataset(&self) -> Result<PrepareResults> {
         println!("{}", "🔧 AI Log Dataset Preparation".bold().cyan());
         println!();
 
-        // Step 1: Create backup
-        println!("{}", "Step 1/5: Creating backup...".yellow());
-        let backup_path = self.create_initial_backup().await?;
-        println!("  ✓ Backup created: {}", backup_path.display());
+        // Step 1: Discover logs
+        println!("{}", "Step 1/3: Discovering logs...".yellow());
+        let home_dir = dirs::home_dir().context("Could not determine home directory")?;
+        let discovery = LogDiscovery::new(home_dir.clone(), true);
+        let findings = discovery.scan_cached()?;
+
+        if findings.locations.is_empty() {
+            return Err(anyhow::anyhow!("No logs found"));
+        }
+
+        let original_size = findings.total_size_bytes;
+        println!(
+            "  ✓ Found {} locations ({})",
+            findings.locations.len(),
+            format_bytes(original_size).cyan()
+        );
         println!();
 
-        // Step 2: Extract to temp
+        // Collect files to process, mirroring the backup archive layout.
+        // Overlapping search patterns can surface the same file twice.
+        let mut seen = HashSet::new();
+        let mut files: Vec<(PathBuf, String)> = Vec::new();
+        for location in &findings.locations {
+            let tool_name = location.tool.name().replace(' ', "_");
+            let log_type = format!("{:?}", location.log_type).to_lowercase();
+
+            if location.path.is_file() {
+                if seen.insert(location.path.clone()) {
+                    let archive_path = format!(
+                        "{}/{}",
+                        tool_name,
+                        location.path.file_name().unwrap().to_string_lossy()
+                    );
+                    files.push((location.path.clone(), archive_path));
+                }
+            } else if location.path.is_dir() {
+                for entry in walkdir::WalkDir::new(&location.path)
+                    .follow_links(false)
+                    .into_iter()
+                    .filter_map(|e| e.ok())
+                {
+                    let path = entry.path();
+                    if path.is_file() && seen.insert(path.to_path_buf()) {
+                        let relative = path.strip_prefix(&home_dir).unwrap_or(path);
+                        let archive_path =
+                            format!("{}/{}/{}", tool_name, log_type, relative.display());
+                        files.push((path.to_path_buf(), archive_path));
+                    }
+                }
+            }
+        }
+
+        // Step 2: sanitize, convert, and archive in one streaming pass.
+        // Workers read and sanitize files in parallel; a bounded channel
+        // feeds the zip writer so memory stays fixed on large trees.
         println!(
             "{}",
-            "Step 2/5: Extracting to temporary directory...".yellow()
+            "Step 2/3: Sanitizing and converting (streaming)...".yellow()
+        );
+
+        fs::create_dir_all(&self.output_dir)?;
+        let dataset_path = self.output_dir.join(format!(
+            "ai-training-dataset-{}.zip",
+            chrono::Utc::now().format("%Y%m%d-%H%M%S")
+        ));
+
+        let pb = ProgressBar::new(files.len() as u64);
+        pb.set_style(
+            ProgressStyle::default_bar()
+                .template("{spinner:.green} [{bar:40.cyan/blue}] {pos}/{len} files")
+                .unwrap()
+                .progress_chars("#>-"),
         );
-        let temp_dir = self.extract_to_temp(&backup_path)?;
-        println!("  ✓ Extracted to: {}", temp_dir.display());
-        println!();
 
-        // Step 3: Sanitize data
-        println!("{}", "Step 3/5: Sanitizing sensitive data...".yellow());
-        let sanitize_stats = self.sanitize_directory(&temp_dir)?;
+        let (tx, rx) = mpsc::sync_channel::<PreparedFile>(PREPARE_QUEUE_DEPTH);
+        let (file_count, training_examples, sanitize_stats) =
+            std::thread::scope(|scope| -> Result<(usize, Vec<TrainingExample>, SanitizeStats)> {
+                let writer = scope.spawn(|| self.write_streaming_archive(&dataset_path, rx));
+
+                let produced = files.par_iter().try_for_each_with(
+                    tx,
+                    |tx, (path, archive_path)| -> Result<()> {
+                        if let Some(prepared) = self.prepare_file(path, archive_path)? {
+                            tx.send(prepared)
+                                .map_err(|_| anyhow::anyhow!("Dataset writer exited early"))?;
+                        }
+                        pb.inc(1);
+                        Ok(())
+                    },
+                );
+
+                let written = writer.join().expect("Dataset writer thread panicked");
+                match (produced, written) {
+                    (Ok(()), Ok(out)) => Ok(out),
+                    // Writer errors (e.g. disk full) caused the send
+                    // failures, so surface them over the producer's error
+                    (_, Err(e)) => Err(e),
+                    (Err(e), _) => Err(e),
+                }
+            })?;
+        pb.finish();
+
         println!("  ✓ Files processed: {}", sanitize_stats.files_processed);
         println!(
             "  ✓ Sensitive items removed: {}",
             sanitize_stats.items_redacted
         );
+        println!(
+            "  ✓ Training examples created: {}",
+            training_examples.len()
+        );
         println!();
 
-        // Step 4: Convert to training format
-        println!("{}", "Step 4/5: Converting to training format...".yellow());
-        let training_examples = self.convert_to_training_format(&temp_dir)?;
-        println!("  ✓ Training examples created: {}", training_examples.len());
-        println!();
-
-        // Step 5: Create final dataset
-        println!("{}", "Step 5/5: Creating final dataset archive...".yellow());
-
-        // Store temp_dir for archive creation
-        let temp_for_archive = temp_dir.clone();
-
-        let dataset_path = self.create_dataset_archive_full(
-            &temp_for_archive,
-            &training_examples,
-            &sanitize_stats,
-        )?;
+        // Step 3: done — the archive was finalized by the writer
+        println!("{}", "Step 3/3: Finalizing dataset archive...".yellow());
         println!("  ✓ Dataset saved: {}", dataset_path.display());
         println!();
 
-        // Cleanup temp directory
-        fs::remove_dir_all(&temp_dir)?;
-
-        // Get sizes before moving paths
-        let original_size = fs::metadata(&backup_path)?.len();
         let sanitized_size = fs::metadata(&dataset_path)?.len();
 
         let results = PrepareResults {
             dataset_path,
-            backup_path,
             examples_count: training_examples.len(),
             original_size,
             sanitized_size,
             items_redacted: sanitize_stats.items_redacted,
-            files_processed: sanitize_stats.files_processed,
+            files_processed: file_count,
         };
 
         self.print_summary(&results);
@@ -113,220 +198,176 @@ impl DatasetPreparer {
         Ok(results)
     }
 
-    async fn create_initial_backup(&self) -> Result<PathBuf> {
-        let temp_dir = std::env::temp_dir();
-        let manager = BackupManager::new(temp_dir.clone(), 6);
-
-        // Create backup without timestamp to have predictable name
-        let backup_path = manager.create_backup(None, false).await?;
-
-        Ok(backup_path)
-    }
-
-    fn extract_to_temp(&self, backup_path: &PathBuf) -> Result<PathBuf> {
-        let temp_dir = std::env::temp_dir().join(format!(
-            "ai-logs-sanitized-{}",
-            chrono::Utc::now().timestamp()
-        ));
-        fs::create_dir_all(&temp_dir)?;
-
-        // Extract tar.gz
-        let tar_gz = File::open(backup_path)?;
-        let tar = flate2::read::GzDecoder::new(tar_gz);
-        let mut archive = tar::Archive::new(tar);
-        archive.unpack(&temp_dir)?;
-
-        Ok(temp_dir)
-    }
-
-    fn sanitize_directory(&self, dir: &PathBuf) -> Result<SanitizeStats> {
+    /// Reads and sanitizes one file in memory. Returns None for files that
+    /// are excluded from the dataset (.env). Binary files and files that
+    /// are not valid UTF-8 are passed through unmodified, matching the old
+    /// pipeline. The live source tree is never written to.
+    fn prepare_file(&self, path: &Path, archive_path: &str) -> Result<Option<PreparedFile>> {
         let mut stats = SanitizeStats {
             files_processed: 0,
             items_redacted: 0,
             redacted_by_type: HashMap::new(),
         };
 
-        let pb = ProgressBar::new_spinner();
-        pb.set_style(
-            ProgressStyle::default_spinner()
-                .template("{spinner:.green} Sanitizing... {msg}")
-                .unwrap(),
-        );
-
-        for entry in walkdir::WalkDir::new(dir)
-            .follow_links(false)
-            .into_iter()
-            .filter_map(|e| e.ok())
-        {
-            let path = entry.path();
-            if !path.is_file() {
-                continue;
-            }
+        // Exclude .env files entirely (too risky)
+        if path.file_name().and_then(|n| n.to_str()) == Some(".env") {
+            return Ok(None);
+        }
 
-            // Skip binary files
-            if let Some(ext) = path.extension() {
-                let ext_str = ext.to_string_lossy().to_lowercase();
-                if matches!(
-                    ext_str.as_str(),
+        // Binary files are copied through untouched
+        let is_binary = path
+            .extension()
+            .map(|ext| {
+                matches!(
+                    ext.to_string_lossy().to_lowercase().as_str(),
                     "png" | "jpg" | "jpeg" | "gif" | "pdf" | "zip" | "tar" | "gz"
-                ) {
-                    continue;
-                }
-            }
-
-            // Skip .env files entirely (too risky)
-            if path.file_name().and_then(|n| n.to_str()) == Some(".env") {
-                fs::remove_file(path)?;
-                stats.files_processed += 1;
-                continue;
-            }
-
-            pb.set_message(format!(
-                "Processing {}",
-                path.file_name().unwrap().to_string_lossy()
-            ));
+                )
+            })
+            .unwrap_or(false);
 
-            if let Ok(content) = fs::read_to_string(path) {
-                // Detect sensitive data
-                let matches = self.sanitizer.detect_sensitive_data(&content);
-                stats.items_redacted += matches.len();
+        if is_binary {
+            let content = fs::read(path)?;
+            stats.files_processed = 1;
+            return Ok(Some(PreparedFile {
+                archive_path: archive_path.to_string(),
+                content,
+                stats,
+                examples: Vec::new(),
+            }));
+        }
 
-                for mat in matches {
-                    *stats.redacted_by_type.entry(mat.data_type).or_insert(0) += 1;
-                }
+        let Ok(content) = fs::read_to_string(path) else {
+            // Not valid UTF-8: archive the raw bytes unsanitized, as the
+            // old sanitize-in-place step also left these untouched
+            let content = fs::read(path)?;
+            stats.files_processed = 1;
+            return Ok(Some(PreparedFile {
+                archive_path: archive_path.to_string(),
+                content,
+                stats,
+                examples: Vec::new(),
+            }));
+        };
 
-                // Sanitize and write back
-                let sanitized = self.sanitizer.sanitize_text(&content);
-                fs::write(path, sanitized)?;
-                stats.files_processed += 1;
-            }
+        // Detect sensitive data for the stats report
+        let matches = self.sanitizer.detect_sensitive_data(&content);
+        stats.items_redacted = matches.len();
+        for mat in matches {
+            *stats.redacted_by_type.entry(mat.data_type).or_insert(0) += 1;
         }
+        stats.files_processed = 1;
+
+        let sanitized = self.sanitizer.sanitize_cow(&content);
 
-        pb.finish_with_message("Sanitization complete!");
+        // Claude history files also yield prompt/completion pairs
+        let examples = if path.file_name().and_then(|n| n.to_str()) == Some("history.jsonl") {
+            self.examples_from_history(&sanitized)
+        } else {
+            Vec::new()
+        };
 
-        Ok(stats)
+        Ok(Some(PreparedFile {
+            archive_path: archive_path.to_string(),
+            content: sanitized.into_owned().into_bytes(),
+            stats,
+            examples,
+        }))
     }
 
-    fn convert_to_training_format(&self, dir: &PathBuf) -> Result<Vec<TrainingExample>> {
+    /// Extracts training examples from an already-sanitized history.jsonl
+    fn examples_from_history(&self, sanitized: &str) -> Vec<TrainingExample> {
         let mut examples = Vec::new();
+        let mut session_id = 0;
 
-        // Find history.jsonl files (Claude format)
-        for entry in walkdir::WalkDir::new(dir)
-            .follow_links(false)
-            .into_iter()
-            .filter_map(|e| e.ok())
-        {
-            let path = entry.path();
-            if path.file_name().and_then(|n| n.to_str()) != Some("history.jsonl") {
+        for line in sanitized.lines() {
+            if line.trim().is_empty() {
                 continue;
             }
 
-            // Parse the history file
-            if let Ok(file) = File::open(path) {
-                let reader = BufReader::new(file);
-                let mut session_id = 0;
-
-                for line in reader.lines().map_while(Result::ok) {
-                    if line.trim().is_empty() {
-                        continue;
-                    }
-
-                    if let Ok(json) = serde_json::from_str::<serde_json::Value>(&line) {
-                        // Extract prompt and completion pairs
-                        if let (Some(prompt), Some(completion)) =
-                            (extract_prompt(&json), extract_completion(&json))
-                        {
-                            // Ensure both are sanitized
-                            let sanitized_prompt = self.sanitizer.sanitize_text(&prompt);
-                            let sanitized_completion = self.sanitizer.sanitize_text(&completion);
-
-                            // Only include if safe
-                            if self.sanitizer.is_safe_for_training(&sanitized_prompt)
-                                && self.sanitizer.is_safe_for_training(&sanitized_completion)
-                            {
-                                examples.push(TrainingExample {
-                                    prompt: sanitized_prompt.clone(),
-                                    completion: sanitized_completion.clone(),
-                                    metadata: ExampleMetadata {
-                                        tool: "Claude Code".to_string(),
-                                        session_id: format!("session_{}", session_id),
-                                        timestamp: json
-                                            .get("timestamp")
-                                            .and_then(|v| v.as_str())
-                                            .map(|s| s.to_string()),
-                                        tokens_estimate: (sanitized_prompt.len()
-                                            + sanitized_completion.len())
-                                            / 4,
-                                    },
-                                });
-
-                                session_id += 1;
-                            }
-                        }
+            if let Ok(json) = serde_json::from_str::<serde_json::Value>(line) {
+                // Extract prompt and completion pairs
+                if let (Some(prompt), Some(completion)) =
+                    (extract_prompt(&json), extract_completion(&json))
+                {
+                    // Only include if safe
+                    if self.sanitizer.is_safe_for_training(&prompt)
+                        && self.sanitizer.is_safe_for_training(&completion)
+                    {
+                        let tokens_estimate = (prompt.len() + completion.len()) / 4;
+                        examples.push(TrainingExample {
+                            prompt,
+                            completion,
+                            metadata: ExampleMetadata {
+                                tool: "Claude Code".to_string(),
+                                session_id: format!("session_{}", session_id),
+                                timestamp: json
+                                    .get("timestamp")
+                                    .and_then(|v| v.as_str())
+                                    .map(|s| s.to_string()),
+                                tokens_estimate,
+                            },
+                        });
+
+                        session_id += 1;
                     }
                 }
             }
         }
 
-        Ok(examples)
+        examples
     }
 
-    fn create_dataset_archive_full(
+    /// Consumes sanitized files from the pipeline, writes them into the
+    /// dataset zip, and finalizes the archive with the training JSONL,
+    /// dataset info, and README
+    fn write_streaming_archive(
         &self,
-        sanitized_dir: &PathBuf,
-        examples: &[TrainingExample],
-        stats: &SanitizeStats,
-    ) -> Result<PathBuf> {
-        let dataset_path = self.output_dir.join(format!(
-            "ai-training-dataset-{}.zip",
-            chrono::Utc::now().format("%Y%m%d-%H%M%S")
-        ));
-
-        let file = File::create(&dataset_path)?;
+        dataset_path: &Path,
+        rx: mpsc::Receiver<PreparedFile>,
+    ) -> Result<(usize, Vec<TrainingExample>, SanitizeStats)> {
+        let file = File::create(dataset_path)?;
         let mut zip = ZipWriter::new(file);
 
         let options = FileOptions::default()
             .compression_method(zip::CompressionMethod::Deflated)
             .unix_permissions(0o644);
 
-        println!("  Adding all sanitized files to archive...");
-        let pb = ProgressBar::new_spinner();
-        pb.set_style(
-            ProgressStyle::default_spinner()
-                .template("{spinner:.green} Adding files... {msg}")
-                .unwrap(),
-        );
+        let mut file_count = 0usize;
+        let mut examples = Vec::new();
+        let mut stats = SanitizeStats {
+            files_processed: 0,
+            items_redacted: 0,
+            redacted_by_type: HashMap::new(),
+        };
 
-        let mut file_count = 0;
+        while let Ok(prepared) = rx.recv() {
+            zip.start_file(&prepared.archive_path, options)?;
+            zip.write_all(&prepared.content)?;
+            file_count += 1;
 
-        for entry in walkdir::WalkDir::new(sanitized_dir)
-            .follow_links(false)
-            .into_iter()
-            .filter_map(|e| e.ok())
-        {
-            let path = entry.path();
-            if !path.is_file() {
-                continue;
+            stats.files_processed += prepared.stats.files_processed;
+            stats.items_redacted += prepared.stats.items_redacted;
+            for (data_type, count) in prepared.stats.redacted_by_type {
+                *stats.redacted_by_type.entry(data_type).or_insert(0) += count;
             }
-
-            // Get relative path for archive
-            let relative_path = path
-                .strip_prefix(sanitized_dir)
-                .unwrap_or(path)
-                .to_string_lossy()
-                .to_string();
-
-            pb.set_message(format!("{} files", file_count));
-
-            // Add file to ZIP
-            zip.start_file(&relative_path, options)?;
-            let content = fs::read(path)?;
-            zip.write_all(&content)?;
-            file_count += 1;
+            examples.extend(prepared.examples);
         }
 
-        pb.finish_with_message(format!("{} files added!", file_count));
+        self.write_dataset_meta(&mut zip, options, file_count, &examples, &stats)?;
+        zip.finish()?;
+
+        Ok((file_count, examples, stats))
+    }
 
+    /// Writes the structured companion files into the dataset archive
+    fn write_dataset_meta(
+        &self,
+        zip: &mut ZipWriter<File>,
+        options: FileOptions,
+        file_count: usize,
+        examples: &[TrainingExample],
+        stats: &SanitizeStats,
+    ) -> Result<()> {
         // Write training examples as JSONL (optional structured format)
         zip.start_file("_training_data.jsonl", options)?;
         for example in examples {
@@ -422,170 +463,7 @@ Use responsibly and in accordance with your organization's data policies.
             file_count, stats.items_redacted
         )?;
 
-        zip.finish()?;
-
-        Ok(dataset_path)
-    }
-
-    #[allow(dead_code)]
-    fn create_dataset_archive(
-        &self,
-        examples: &[TrainingExample],
-        stats: &SanitizeStats,
-    ) -> Result<PathBuf> {
-        let dataset_path = self.output_dir.join(format!(
-            "ai-training-dataset-{}.zip",
-            chrono::Utc::now().format("%Y%m%d-%H%M%S")
-        ));
-
-        let file = File::create(&dataset_path)?;
-        let mut zip = ZipWriter::new(file);
-
-        let options = FileOptions::default()
-            .compression_method(zip::CompressionMethod::Deflated)
-            .unix_permissions(0o644);
-
-        // Write ALL sanitized files from temp directory
-        let temp_dir = std::env::temp_dir().join(format!(
-            "ai-logs-sanitized-{}",
-            chrono::Utc::now().timestamp()
-        ));
-
-        println!("  Adding all sanitized files to archive...");
-        let pb = ProgressBar::new_spinner();
-        pb.set_style(
-            ProgressStyle::default_spinner()
-                .template("{spinner:.green} Adding files... {msg}")
-                .unwrap(),
-        );
-
-        for entry in walkdir::WalkDir::new(&temp_dir)
-            .follow_links(false)
-            .into_iter()
-            .filter_map(|e| e.ok())
-        {
-            let path = entry.path();
-            if !path.is_file() {
-                continue;
-            }
-
-            // Get relative path for archive
-            let relative_path = path
-                .strip_prefix(&temp_dir)
-                .unwrap_or(path)
-                .to_string_lossy()
-                .to_string();
-
-            pb.set_message(relative_path.clone());
-
-            // Add file to ZIP
-            zip.start_file(&relative_path, options)?;
-            let content = fs::read(path)?;
-            zip.write_all(&content)?;
-        }
-
-        pb.finish_with_message("All files added!");
-
-        // Write training examples as JSONL (optional structured format)
-        zip.start_file("_training_data.jsonl", options)?;
-        for example in examples {
-            // Optionally strip metadata if not needed
-            let json = if self.include_metadata {
-                serde_json::to_string(example)?
-            } else {
-                // Only include prompt and completion, strip metadata
-                serde_json::to_string(&serde_json::json!({
-                    "prompt": example.prompt,
-                    "completion": example.completion
-                }))?
-            };
-            writeln!(zip, "{}", json)?;
-        }
-
-        // Write metadata
-        zip.start_file("_dataset_info.json", options)?;
-        let info = serde_json::json!({
-            "total_examples": examples.len(),
-            "total_tokens_estimate": examples.iter().map(|e| e.metadata.tokens_estimate).sum::<usize>(),
-            "sanitization_stats": {
-                "files_processed": stats.files_processed,
-                "items_redacted": stats.items_redacted,
-                "redacted_by_type": stats.redacted_by_type.iter()
-                    .map(|(k, v)| (k.to_string(), v))
-                    .collect::<HashMap<_, _>>(),
-            },
-            "generated_at": chrono::Utc::now().to_rfc3339(),
-            "format": "complete_sanitized_logs",
-            "safe_for_training": true,
-        });
-        write!(zip, "{}", serde_json::to_string_pretty(&info)?)?;
-
-        // Write README
-        zip.start_file("README.md", options)?;
-        write!(
-            zip,
-            r#"# AI Training Dataset
-
-## Overview
-
-This dataset was prepared from AI coding assistant logs with all sensitive data removed.
-
-## Contents
-
-- `training_data.jsonl` - Training examples in JSONL format
-- `dataset_info.json` - Metadata and statistics
-- `README.md` - This file
-
-## Format
-
-Each line in `training_data.jsonl` contains:
-```json
-{{
-  "prompt": "User's question or request",
-  "completion": "AI assistant's response",
-  "metadata": {{
-    "tool": "Tool name",
-    "session_id": "Unique session identifier",
-    "timestamp": "ISO 8601 timestamp",
-    "tokens_estimate": 1234
-  }}
-}}
-```
-
-## Sanitization
-
-All sensitive data has been removed:
-- API keys and tokens
-- Passwords
-- Email addresses
-- Phone numbers
-- Credit card numbers
-- Social Security Numbers
-- IP addresses
-- Personal file paths
-- Environment variables
-
-**Files processed:** {}
-**Items redacted:** {}
-
-## Usage
-
-This dataset is safe for:
-- Model finetuning
-- Training experiments
-- Research purposes
-- Sharing with team members
-
-## License
-
-Use responsibly and in accordance with your organization's data policies.
-"#,
-            stats.files_processed, stats.items_redacted
-        )?;
-
-        zip.finish()?;
-
-        Ok(dataset_path)
+        Ok(())
     }
 
     fn print_summary(&self, results: &PrepareResults) {
@@ -606,7 +484,7 @@ Use responsibly and in accordance with your organization's data policies.
         println!();
         println!("💾 File Sizes:");
         println!(
-            "  Original Backup:      {}",
+            "  Source Logs:          {}",
             format_bytes(results.original_size)
         );
         println!(
@@ -619,10 +497,6 @@ Use responsibly and in accordance with your organization's data policies.
         );
         println!();
         println!("📁 Output:");
-        println!(
-            "  Backup:               {}",
-            results.backup_path.display().to_string().yellow()
-        );
         println!(
             "  Dataset:              {}",
             results.dataset_path.display().to_string().cyan()
@@ -638,7 +512,6 @@ Use responsibly and in accordance with your organization's data policies.
 
 pub struct PrepareResults {
     pub dataset_path: PathBuf,
-    pub backup_path: PathBuf,
     pub examples_count: usize,
     pub original_size: u64,
     pub sanitized_size: u64,
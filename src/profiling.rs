@@ -0,0 +1,216 @@
+//! Hot-path profiling behind the global `--profile` flag.
+//!
+//! A custom tracing [`Layer`] times every span, aggregating elapsed time,
+//! call counts and recorded `bytes` fields per span path. When the guard
+//! returned by [`init`] drops at the end of the run it prints a
+//! stage-by-stage breakdown and writes a folded-stack trace file that
+//! `inferno-flamegraph` / `flamegraph.pl` can render directly.
+//!
+//! Allocation counts are deliberately out of scope: they would require
+//! swapping in an instrumented global allocator for every build. Time and
+//! byte throughput cover what we need for precise slowdown reports.
+
+use anyhow::Result;
+use std::collections::HashMap;
+use std::fs;
+use std::sync::{Arc, Mutex};
+use std::time::{Duration, Instant};
+use tracing::field::{Field, Visit};
+use tracing::{span, Level, Subscriber};
+use tracing_subscriber::layer::{Context, Layer, SubscriberExt};
+use tracing_subscriber::registry::LookupSpan;
+use tracing_subscriber::util::SubscriberInitExt;
+
+use crate::models::format_bytes;
+
+/// Folded-stack trace written next to the current working directory.
+const TRACE_FILE: &str = "vibedev-profile.folded";
+
+/// Aggregate for one span path ("parent;child" folded notation).
+#[derive(Default)]
+struct StageStats {
+    calls: u64,
+    total: Duration,
+    bytes: u64,
+}
+
+type StatsMap = Arc<Mutex<HashMap<String, StageStats>>>;
+
+/// Per-span state stashed in the span's extensions at creation time.
+struct SpanTiming {
+    started: Instant,
+    bytes: u64,
+}
+
+/// Picks up a `bytes` field recorded on a span so throughput can be shown.
+struct BytesVisitor(u64);
+
+impl Visit for BytesVisitor {
+    fn record_u64(&mut self, field: &Field, value: u64) {
+        if field.name() == "bytes" {
+            self.0 = value;
+        }
+    }
+
+    fn record_i64(&mut self, field: &Field, value: i64) {
+        if field.name() == "bytes" && value >= 0 {
+            self.0 = value as u64;
+        }
+    }
+
+    fn record_debug(&mut self, _field: &Field, _value: &dyn std::fmt::Debug) {}
+}
+
+struct ProfileLayer {
+    stats: StatsMap,
+}
+
+impl<S> Layer<S> for ProfileLayer
+where
+    S: Subscriber + for<'a> LookupSpan<'a>,
+{
+    fn on_new_span(&self, attrs: &span::Attributes<'_>, id: &span::Id, ctx: Context<'_, S>) {
+        let mut visitor = BytesVisitor(0);
+        attrs.record(&mut visitor);
+        if let Some(span) = ctx.span(id) {
+            span.extensions_mut().insert(SpanTiming {
+                started: Instant::now(),
+                bytes: visitor.0,
+            });
+        }
+    }
+
+    fn on_close(&self, id: span::Id, ctx: Context<'_, S>) {
+        let Some(span) = ctx.span(&id) else { return };
+        let (elapsed, bytes) = match span.extensions().get::<SpanTiming>() {
+            Some(t) => (t.started.elapsed(), t.bytes),
+            None => return,
+        };
+
+        // Root-to-leaf span path in folded-stack notation
+        let mut names: Vec<&'static str> = span.scope().map(|s| s.name()).collect();
+        names.reverse();
+        let key = names.join(";");
+
+        let mut stats = self.stats.lock().unwrap();
+        let entry = stats.entry(key).or_default();
+        entry.calls += 1;
+        entry.total += elapsed;
+        entry.bytes += bytes;
+    }
+}
+
+/// Prints the breakdown and writes the folded trace when dropped at the
+/// end of `main`, after every instrumented span has closed.
+pub struct ProfileGuard {
+    stats: StatsMap,
+    started: Instant,
+}
+
+/// Installs a subscriber that both logs (like the default setup) and feeds
+/// the profiling layer. Hold the returned guard until the end of `main`.
+pub fn init(verbose: bool) -> Result<ProfileGuard> {
+    let level = if verbose { Level::DEBUG } else { Level::INFO };
+    let stats: StatsMap = Arc::default();
+    let layer = ProfileLayer {
+        stats: Arc::clone(&stats),
+    };
+
+    tracing_subscriber::registry()
+        .with(tracing_subscriber::filter::LevelFilter::from_level(level))
+        .with(tracing_subscriber::fmt::layer().with_target(false))
+        .with(layer)
+        .try_init()?;
+
+    Ok(ProfileGuard {
+        stats,
+        started: Instant::now(),
+    })
+}
+
+fn format_duration(d: Duration) -> String {
+    if d.as_secs_f64() >= 1.0 {
+        format!("{:.2}s", d.as_secs_f64())
+    } else if d.as_millis() >= 1 {
+        format!("{:.1}ms", d.as_secs_f64() * 1000.0)
+    } else {
+        format!("{}µs", d.as_micros())
+    }
+}
+
+impl Drop for ProfileGuard {
+    fn drop(&mut self) {
+        let stats = match self.stats.lock() {
+            Ok(stats) => stats,
+            Err(_) => return,
+        };
+        if stats.is_empty() {
+            eprintln!("\n⏱️  Profile: no instrumented spans were hit by this command");
+            return;
+        }
+
+        let mut rows: Vec<(&String, &StageStats)> = stats.iter().collect();
+        rows.sort_by(|a, b| b.1.total.cmp(&a.1.total));
+
+        eprintln!(
+            "\n⏱️  Profile breakdown (wall time {}):",
+            format_duration(self.started.elapsed())
+        );
+        eprintln!(
+            "   {:<48} {:>7} {:>9} {:>9} {:>10} {:>11}",
+            "stage", "calls", "total", "mean", "bytes", "throughput"
+        );
+        for (path, s) in &rows {
+            let mean = s.total / s.calls.max(1) as u32;
+            let (bytes, throughput) = if s.bytes > 0 {
+                let per_sec = s.bytes as f64 / s.total.as_secs_f64().max(1e-9);
+                (
+                    format_bytes(s.bytes),
+                    format!("{}/s", format_bytes(per_sec as u64)),
+                )
+            } else {
+                ("-".to_string(), "-".to_string())
+            };
+            eprintln!(
+                "   {:<48} {:>7} {:>9} {:>9} {:>10} {:>11}",
+                path,
+                s.calls,
+                format_duration(s.total),
+                format_duration(mean),
+                bytes,
+                throughput
+            );
+        }
+
+        // Folded stacks want self time per path, so subtract each path's
+        // total from its direct parent before emitting sample counts (µs)
+        let mut self_us: HashMap<String, i128> = stats
+            .iter()
+            .map(|(path, s)| (path.clone(), s.total.as_micros() as i128))
+            .collect();
+        for (path, s) in stats.iter() {
+            if let Some(idx) = path.rfind(';') {
+                if let Some(parent) = self_us.get_mut(&path[..idx]) {
+                    *parent -= s.total.as_micros() as i128;
+                }
+            }
+        }
+        let folded: String = rows
+            .iter()
+            .map(|(path, _)| {
+                format!(
+                    "{} {}\n",
+                    path.replace(' ', "_"),
+                    self_us.get(*path).copied().unwrap_or(0).max(0)
+                )
+            })
+            .collect();
+        match fs::write(TRACE_FILE, folded) {
+            Ok(()) => eprintln!(
+                "\n   Folded trace written to {} (inferno / flamegraph.pl compatible)",
+                TRACE_FILE
+            ),
+            Err(e) => eprintln!("\n   Failed to write {}: {}", TRACE_FILE, e),
+        }
+    }
+}
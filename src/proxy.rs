@@ -3,16 +3,26 @@
 //! This module provides an HTTP/HTTPS proxy that intercepts traffic to
 //! api.anthropic.com and logs it for monitoring.
 
-use crate::traffic::TrafficLog;
+use crate::traffic::{
+    parse_request, parse_stream_event, ApiResponse, StreamEvent, TrafficLog, Usage,
+};
 use anyhow::Result;
 use rcgen::{Certificate, CertificateParams, DistinguishedName, DnType, KeyPair, PKCS_ECDSA_P256_SHA256};
 use std::fs;
 use std::net::SocketAddr;
 use std::path::PathBuf;
+use std::time::Instant;
 use tokio::io::{AsyncReadExt, AsyncWriteExt};
 use tokio::net::{TcpListener, TcpStream};
 use tokio::sync::mpsc;
 
+/// Relay chunk size for the teed server-to-client copy
+const RELAY_BUF_SIZE: usize = 16 * 1024;
+
+/// Cap on the rolling SSE line buffer; oversized lines are truncated for
+/// analytics but still relayed in full
+const STREAM_LINE_BUF_MAX: usize = 64 * 1024;
+
 /// Event sent from proxy to TUI
 #[derive(Debug, Clone)]
 pub enum ProxyEvent {
@@ -150,9 +160,12 @@ fn generate_ca() -> Result<CaCert> {
 async fn handle_connection(
     mut stream: TcpStream,
     _addr: SocketAddr,
-    _traffic_log: TrafficLog,
-    _event_tx: mpsc::UnboundedSender<ProxyEvent>,
+    traffic_log: TrafficLog,
+    event_tx: mpsc::UnboundedSender<ProxyEvent>,
 ) -> Result<()> {
+    // Small writes (SSE deltas) must go out immediately
+    let _ = stream.set_nodelay(true);
+
     let mut buf = vec![0u8; 8192];
     let n = stream.read(&mut buf).await?;
     if n == 0 {
@@ -165,8 +178,8 @@ async fn handle_connection(
     if request_line.starts_with("CONNECT ") {
         handle_connect(stream, &request_line).await
     } else {
-        // Regular HTTP proxy - just forward
-        handle_http(stream, &buf[..n]).await
+        // Regular HTTP proxy - forward, teeing visible API traffic
+        handle_http(stream, &buf[..n], traffic_log, event_tx).await
     }
 }
 
@@ -204,26 +217,15 @@ async fn handle_connect(
     // Connect to target and tunnel
     let server_addr = format!("{}:{}", host, port);
     let server_stream = TcpStream::connect(&server_addr).await?;
+    let _ = server_stream.set_nodelay(true);
     tunnel_streams(client_stream, server_stream).await
 }
 
-/// Pipe two streams together
+/// Pipe two streams together. copy_bidirectional relays each chunk as it
+/// arrives and propagates half-closes instead of tearing down the other
+/// direction when one side finishes.
 async fn tunnel_streams(mut client: TcpStream, mut server: TcpStream) -> Result<()> {
-    let (mut client_read, mut client_write) = client.split();
-    let (mut server_read, mut server_write) = server.split();
-
-    let client_to_server = tokio::io::copy(&mut client_read, &mut server_write);
-    let server_to_client = tokio::io::copy(&mut server_read, &mut client_write);
-
-    tokio::select! {
-        result = client_to_server => {
-            result?;
-        }
-        result = server_to_client => {
-            result?;
-        }
-    }
-
+    tokio::io::copy_bidirectional(&mut client, &mut server).await?;
     Ok(())
 }
 
@@ -231,6 +233,8 @@ async fn tunnel_streams(mut client: TcpStream, mut server: TcpStream) -> Result<
 async fn handle_http(
     mut client_stream: TcpStream,
     initial_data: &[u8],
+    traffic_log: TrafficLog,
+    event_tx: mpsc::UnboundedSender<ProxyEvent>,
 ) -> Result<()> {
     // Parse the HTTP request
     let request_str = String::from_utf8_lossy(initial_data);
@@ -270,13 +274,187 @@ async fn handle_http(
     let server_addr = format!("{}:{}", host, port);
 
     if let Ok(mut server_stream) = TcpStream::connect(&server_addr).await {
+        let _ = server_stream.set_nodelay(true);
         server_stream.write_all(initial_data).await?;
-        tunnel_streams(client_stream, server_stream).await?;
+
+        // If the buffered request body parses as an Anthropic API call,
+        // log it and tee the response through the incremental SSE
+        // scanner; otherwise fall back to the plain relay
+        let mut request_id = None;
+        if let Some(body) = http_body(initial_data) {
+            if let Ok(request) = parse_request(body) {
+                let model = request.model.clone();
+                let stream = request.stream;
+                let id = traffic_log.start_request(request);
+                if stream {
+                    traffic_log.mark_streaming(id);
+                }
+                let _ = event_tx.send(ProxyEvent::RequestStarted { id, model, stream });
+                request_id = Some(id);
+            }
+        }
+
+        match request_id {
+            Some(id) => {
+                let started = Instant::now();
+                let mut tee = StreamTee::new(id, event_tx.clone());
+                let result = relay_with_tee(client_stream, server_stream, &mut tee).await;
+                let latency_ms = started.elapsed().as_millis() as u64;
+
+                match result {
+                    Ok(()) => {
+                        let usage = tee.usage.clone();
+                        let tokens_in = usage.input_tokens;
+                        let tokens_out = usage.output_tokens;
+                        traffic_log.complete_request(
+                            id,
+                            ApiResponse {
+                                id: None,
+                                model: None,
+                                content: vec![],
+                                usage: Some(usage),
+                                stop_reason: None,
+                                raw_body: None,
+                            },
+                            latency_ms,
+                        );
+                        let _ = event_tx.send(ProxyEvent::RequestCompleted {
+                            id,
+                            tokens_in,
+                            tokens_out,
+                            latency_ms,
+                        });
+                    }
+                    Err(e) => {
+                        traffic_log.fail_request(id, e.to_string());
+                        let _ = event_tx.send(ProxyEvent::RequestFailed {
+                            id,
+                            error: e.to_string(),
+                        });
+                        return Err(e);
+                    }
+                }
+            }
+            None => tunnel_streams(client_stream, server_stream).await?,
+        }
     }
 
     Ok(())
 }
 
+/// Body of a buffered HTTP request, if the header terminator was read
+fn http_body(data: &[u8]) -> Option<&str> {
+    let text = std::str::from_utf8(data).ok()?;
+    let body = &text[text.find("\r\n\r\n")? + 4..];
+    if body.is_empty() {
+        None
+    } else {
+        Some(body)
+    }
+}
+
+/// Incremental SSE scanner fed off a tee of the server-to-client relay.
+/// Keeps one bounded rolling line buffer; the relay itself never waits
+/// on parsing.
+struct StreamTee {
+    id: u64,
+    line_buf: Vec<u8>,
+    usage: Usage,
+    event_tx: mpsc::UnboundedSender<ProxyEvent>,
+}
+
+impl StreamTee {
+    fn new(id: u64, event_tx: mpsc::UnboundedSender<ProxyEvent>) -> Self {
+        Self {
+            id,
+            line_buf: Vec::new(),
+            usage: Usage::default(),
+            event_tx,
+        }
+    }
+
+    fn feed(&mut self, chunk: &[u8]) {
+        for &byte in chunk {
+            if byte == b'\n' {
+                self.scan_line();
+                self.line_buf.clear();
+            } else if self.line_buf.len() < STREAM_LINE_BUF_MAX {
+                self.line_buf.push(byte);
+            }
+        }
+    }
+
+    fn scan_line(&mut self) {
+        let Ok(line) = std::str::from_utf8(&self.line_buf) else {
+            return;
+        };
+
+        if let Some(StreamEvent::Data(data)) = parse_stream_event(line.trim_end_matches('\r')) {
+            // message_start carries input tokens, message_delta output
+            // tokens; keep the latest non-zero value of each
+            if let Some(usage) = data.usage {
+                if usage.input_tokens > 0 {
+                    self.usage.input_tokens = usage.input_tokens;
+                }
+                if usage.output_tokens > 0 {
+                    self.usage.output_tokens = usage.output_tokens;
+                }
+                if usage.cache_creation_input_tokens > 0 {
+                    self.usage.cache_creation_input_tokens = usage.cache_creation_input_tokens;
+                }
+                if usage.cache_read_input_tokens > 0 {
+                    self.usage.cache_read_input_tokens = usage.cache_read_input_tokens;
+                }
+            }
+
+            if let Some(text) = data.delta.and_then(|d| d.text) {
+                let _ = self.event_tx.send(ProxyEvent::StreamChunk { id: self.id, text });
+            }
+        }
+    }
+}
+
+/// Relay both directions, forwarding each server chunk to the client
+/// before feeding a copy to the analytics tee, so time-to-first-token is
+/// whatever the upstream delivers
+async fn relay_with_tee(
+    mut client: TcpStream,
+    mut server: TcpStream,
+    tee: &mut StreamTee,
+) -> Result<()> {
+    let (mut client_read, mut client_write) = client.split();
+    let (mut server_read, mut server_write) = server.split();
+
+    // Tee-equivalent of copy_bidirectional: EOF on one side half-closes
+    // the peer's write half and the other direction keeps draining, so a
+    // client that shuts down its write side after sending the request
+    // still receives the whole response
+    let upstream = async {
+        tokio::io::copy(&mut client_read, &mut server_write).await?;
+        server_write.shutdown().await?;
+        Ok::<(), std::io::Error>(())
+    };
+
+    let downstream = async {
+        let mut buf = vec![0u8; RELAY_BUF_SIZE];
+        loop {
+            let n = server_read.read(&mut buf).await?;
+            if n == 0 {
+                break;
+            }
+            // Relay first; the client is never gated on analytics
+            client_write.write_all(&buf[..n]).await?;
+            tee.feed(&buf[..n]);
+        }
+        client_write.shutdown().await?;
+        Ok::<(), std::io::Error>(())
+    };
+
+    tokio::try_join!(upstream, downstream)?;
+
+    Ok(())
+}
+
 /// Get the CA certificate path
 pub fn get_ca_cert_path() -> PathBuf {
     ProxyConfig::default().ca_cert_path
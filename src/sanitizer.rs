@@ -1,51 +1,97 @@
 #![allow(dead_code)]
 
 use anyhow::Result;
-use regex::Regex;
+use rayon::prelude::*;
+use regex::{Regex, RegexSet};
+use std::borrow::Cow;
+
+/// Which Sanitizer toggle gates a rule; rules without a gate always apply
+#[derive(Clone, Copy, PartialEq)]
+enum Gate {
+    Emails,
+    Ips,
+    Paths,
+}
 
-lazy_static::lazy_static! {
-    // API Keys and Tokens
-    static ref API_KEY_PATTERNS: Vec<Regex> = vec![
-        Regex::new(r"sk-[a-zA-Z0-9]{20,}").unwrap(),                    // OpenAI/Anthropic keys
-        Regex::new(r"sk-ant-[a-zA-Z0-9-]{20,}").unwrap(),               // Anthropic keys
-        Regex::new(r"ghp_[a-zA-Z0-9]{36}").unwrap(),                    // GitHub tokens
-        Regex::new(r"gho_[a-zA-Z0-9]{36}").unwrap(),                    // GitHub OAuth
-        Regex::new(r"github_pat_[a-zA-Z0-9]{22}_[a-zA-Z0-9]{59}").unwrap(), // GitHub PAT
-        Regex::new(r"glpat-[a-zA-Z0-9-]{20}").unwrap(),                // GitLab tokens
-        Regex::new(r"xox[baprs]-[a-zA-Z0-9-]+").unwrap(),               // Slack tokens
-        Regex::new(r"AKIA[0-9A-Z]{16}").unwrap(),                       // AWS access keys
-        Regex::new(r"ya29\.[a-zA-Z0-9_-]+").unwrap(),                   // Google OAuth
-        Regex::new(r"AIza[0-9A-Za-z_-]{35}").unwrap(),                  // Google API keys
-        Regex::new(r"[0-9]+-[0-9A-Za-z_]{32}\.apps\.googleusercontent\.com").unwrap(), // Google OAuth client
-        Regex::new(r"Bearer [a-zA-Z0-9_.=-]+").unwrap(),              // Bearer tokens
-        Regex::new(r#"token[:=]\s*["']?[a-zA-Z0-9_.-]{20,}"#).unwrap(), // Generic tokens
-    ];
+/// One redaction rule: the pattern, its replacement, and what it detects.
+/// All rules are compiled together into a single RegexSet so sanitizing
+/// scans each input once instead of once per pattern.
+struct Rule {
+    pattern: &'static str,
+    replacement: &'static str,
+    gate: Option<Gate>,
+    data_type: SensitiveDataType,
+}
 
-    // Passwords
-    static ref PASSWORD_PATTERNS: Vec<Regex> = vec![
-        Regex::new(r#"password[:=]\s*["']([^"']+)["']"#).unwrap(),
-        Regex::new(r#"passwd[:=]\s*["']([^"']+)["']"#).unwrap(),
-        Regex::new(r#"pwd[:=]\s*["']([^"']+)["']"#).unwrap(),
-        Regex::new(r#"pass[:=]\s*["']([^"']+)["']"#).unwrap(),
-    ];
+const fn rule(
+    pattern: &'static str,
+    replacement: &'static str,
+    gate: Option<Gate>,
+    data_type: SensitiveDataType,
+) -> Rule {
+    Rule {
+        pattern,
+        replacement,
+        gate,
+        data_type,
+    }
+}
 
+/// Redaction rules in application order (API keys before broader PII
+/// patterns so token-like matches are not partially consumed)
+const RULES: &[Rule] = &[
+    // API Keys and Tokens
+    rule(r"sk-[a-zA-Z0-9]{20,}", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // OpenAI/Anthropic keys
+    rule(r"sk-ant-[a-zA-Z0-9-]{20,}", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // Anthropic keys
+    rule(r"ghp_[a-zA-Z0-9]{36}", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // GitHub tokens
+    rule(r"gho_[a-zA-Z0-9]{36}", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // GitHub OAuth
+    rule(r"github_pat_[a-zA-Z0-9]{22}_[a-zA-Z0-9]{59}", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // GitHub PAT
+    rule(r"glpat-[a-zA-Z0-9-]{20}", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // GitLab tokens
+    rule(r"xox[baprs]-[a-zA-Z0-9-]+", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // Slack tokens
+    rule(r"AKIA[0-9A-Z]{16}", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // AWS access keys
+    rule(r"ya29\.[a-zA-Z0-9_-]+", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // Google OAuth
+    rule(r"AIza[0-9A-Za-z_-]{35}", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // Google API keys
+    rule(r"[0-9]+-[0-9A-Za-z_]{32}\.apps\.googleusercontent\.com", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // Google OAuth client
+    rule(r"Bearer [a-zA-Z0-9_.=-]+", "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // Bearer tokens
+    rule(r#"token[:=]\s*["']?[a-zA-Z0-9_.-]{20,}"#, "[REDACTED_API_KEY]", None, SensitiveDataType::ApiKey), // Generic tokens
+    // Passwords
+    rule(r#"password[:=]\s*["']([^"']+)["']"#, "password=\"[REDACTED]\"", None, SensitiveDataType::Password),
+    rule(r#"passwd[:=]\s*["']([^"']+)["']"#, "password=\"[REDACTED]\"", None, SensitiveDataType::Password),
+    rule(r#"pwd[:=]\s*["']([^"']+)["']"#, "password=\"[REDACTED]\"", None, SensitiveDataType::Password),
+    rule(r#"pass[:=]\s*["']([^"']+)["']"#, "password=\"[REDACTED]\"", None, SensitiveDataType::Password),
     // Personal Identifiable Information
-    static ref EMAIL_REGEX: Regex = Regex::new(r"\b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Z|a-z]{2,}\b").unwrap();
-    static ref PHONE_REGEX: Regex = Regex::new(r"\b(\+?1?[-.\s]?)?\(?\d{3}\)?[-.\s]?\d{3}[-.\s]?\d{4}\b").unwrap();
-    static ref SSN_REGEX: Regex = Regex::new(r"\b\d{3}-\d{2}-\d{4}\b").unwrap();
-    static ref CREDIT_CARD_REGEX: Regex = Regex::new(r"\b\d{4}[-\s]?\d{4}[-\s]?\d{4}[-\s]?\d{4}\b").unwrap();
-    static ref IP_REGEX: Regex = Regex::new(r"\b\d{1,3}\.\d{1,3}\.\d{1,3}\.\d{1,3}\b").unwrap();
-
-    // File paths
-    static ref HOME_PATH_REGEX: Regex = Regex::new(r"/home/[^/\s]+").unwrap();
-    static ref USERS_PATH_REGEX: Regex = Regex::new(r"/Users/[^/\s]+").unwrap();
-    static ref WINDOWS_PATH_REGEX: Regex = Regex::new(r"C:\\Users\\[^\\]+").unwrap();
-
+    rule(r"\b\d{4}[-\s]?\d{4}[-\s]?\d{4}[-\s]?\d{4}\b", "[REDACTED_CC]", None, SensitiveDataType::CreditCard),
+    rule(r"\b\d{3}-\d{2}-\d{4}\b", "[REDACTED_SSN]", None, SensitiveDataType::Ssn),
+    rule(r"\b(\+?1?[-.\s]?)?\(?\d{3}\)?[-.\s]?\d{3}[-.\s]?\d{4}\b", "[REDACTED_PHONE]", None, SensitiveDataType::Phone),
+    rule(r"\b[A-Za-z0-9._%+-]+@[A-Za-z0-9.-]+\.[A-Z|a-z]{2,}\b", "[REDACTED_EMAIL]", Some(Gate::Emails), SensitiveDataType::Email),
+    rule(r"\b\d{1,3}\.\d{1,3}\.\d{1,3}\.\d{1,3}\b", "[REDACTED_IP]", Some(Gate::Ips), SensitiveDataType::IpAddress),
     // URLs with auth
-    static ref URL_WITH_AUTH: Regex = Regex::new(r"https?://[^:]+:[^@]+@").unwrap();
+    rule(r"https?://[^:]+:[^@]+@", "https://[REDACTED_AUTH]@", None, SensitiveDataType::Password),
+    // File paths
+    rule(r"/home/[^/\s]+", "/home/[USER]", Some(Gate::Paths), SensitiveDataType::FilePath),
+    rule(r"/Users/[^/\s]+", "/Users/[USER]", Some(Gate::Paths), SensitiveDataType::FilePath),
+    rule(r"C:\\Users\\[^\\]+", "C:\\Users\\[USER]", Some(Gate::Paths), SensitiveDataType::FilePath),
+    // Environment variables that might contain secrets
+    rule(r"(?m)^[A-Z_][A-Z0-9_]*=.+$", "[REDACTED_ENV_VAR]", None, SensitiveDataType::EnvironmentVariable),
+];
+
+/// All rules compiled once. The RegexSet answers "which rules match this
+/// input" in one scan (the regex crate extracts literal prefilters for
+/// prefixed key patterns like `sk-`, `ghp_`, `AKIA` internally); only the
+/// rules that matched then rewrite the text.
+struct Engine {
+    set: RegexSet,
+    regexes: Vec<Regex>,
+}
 
-    // Environment variables
-    static ref ENV_VAR_PATTERN: Regex = Regex::new(r"(?m)^[A-Z_][A-Z0-9_]*=.+$").unwrap();
+lazy_static::lazy_static! {
+    static ref ENGINE: Engine = {
+        let patterns: Vec<&str> = RULES.iter().map(|r| r.pattern).collect();
+        Engine {
+            set: RegexSet::new(&patterns).unwrap(),
+            regexes: patterns.iter().map(|p| Regex::new(p).unwrap()).collect(),
+        }
+    };
 }
 
 pub struct Sanitizer {
@@ -70,126 +116,83 @@ impl Sanitizer {
         Ok(self)
     }
 
-    pub fn sanitize_text(&self, text: &str) -> String {
-        let mut sanitized = text.to_string();
-
-        // Remove API keys and tokens
-        for pattern in API_KEY_PATTERNS.iter() {
-            sanitized = pattern
-                .replace_all(&sanitized, "[REDACTED_API_KEY]")
-                .to_string();
+    fn gate_open(&self, gate: Option<Gate>) -> bool {
+        match gate {
+            None => true,
+            Some(Gate::Emails) => self.redact_emails,
+            Some(Gate::Ips) => self.redact_ips,
+            Some(Gate::Paths) => self.redact_paths,
         }
+    }
 
-        // Remove passwords
-        for pattern in PASSWORD_PATTERNS.iter() {
-            sanitized = pattern
-                .replace_all(&sanitized, "password=\"[REDACTED]\"")
-                .to_string();
-        }
+    pub fn sanitize_text(&self, text: &str) -> String {
+        self.sanitize_cow(text).into_owned()
+    }
 
-        // Remove credit cards
-        sanitized = CREDIT_CARD_REGEX
-            .replace_all(&sanitized, "[REDACTED_CC]")
-            .to_string();
-
-        // Remove SSNs
-        sanitized = SSN_REGEX
-            .replace_all(&sanitized, "[REDACTED_SSN]")
-            .to_string();
-
-        // Remove phone numbers
-        sanitized = PHONE_REGEX
-            .replace_all(&sanitized, "[REDACTED_PHONE]")
-            .to_string();
-
-        // Remove emails
-        if self.redact_emails {
-            sanitized = EMAIL_REGEX
-                .replace_all(&sanitized, "[REDACTED_EMAIL]")
-                .to_string();
-        }
+    /// Sanitizes with a single combined scan. Clean input (the common
+    /// case) is returned borrowed without any allocation; the first
+    /// actual replacement switches to an owned buffer.
+    pub fn sanitize_cow<'t>(&self, text: &'t str) -> Cow<'t, str> {
+        let mut out = Cow::Borrowed(text);
 
-        // Remove IPs
-        if self.redact_ips {
-            sanitized = IP_REGEX
-                .replace_all(&sanitized, "[REDACTED_IP]")
-                .to_string();
-        }
+        for idx in ENGINE.set.matches(text).iter() {
+            let rule = &RULES[idx];
+            if !self.gate_open(rule.gate) {
+                continue;
+            }
 
-        // Remove URLs with authentication
-        sanitized = URL_WITH_AUTH
-            .replace_all(&sanitized, "https://[REDACTED_AUTH]@")
-            .to_string();
-
-        // Anonymize file paths
-        if self.redact_paths {
-            sanitized = HOME_PATH_REGEX
-                .replace_all(&sanitized, "/home/[USER]")
-                .to_string();
-            sanitized = USERS_PATH_REGEX
-                .replace_all(&sanitized, "/Users/[USER]")
-                .to_string();
-            sanitized = WINDOWS_PATH_REGEX
-                .replace_all(&sanitized, "C:\\Users\\[USER]")
-                .to_string();
+            if let Cow::Owned(replaced) = ENGINE.regexes[idx].replace_all(&out, rule.replacement)
+            {
+                out = Cow::Owned(replaced);
+            }
         }
 
-        // Remove environment variables that might contain secrets
-        sanitized = ENV_VAR_PATTERN
-            .replace_all(&sanitized, "[REDACTED_ENV_VAR]")
-            .to_string();
-
-        // Apply custom patterns
         for pattern in &self.custom_patterns {
-            sanitized = pattern.replace_all(&sanitized, "[REDACTED]").to_string();
+            if let Cow::Owned(replaced) = pattern.replace_all(&out, "[REDACTED]") {
+                out = Cow::Owned(replaced);
+            }
         }
 
-        sanitized
+        out
+    }
+
+    /// Sanitizes a batch of documents in parallel, rewriting in place.
+    /// Documents without matches are left untouched.
+    pub fn sanitize_many(&self, texts: &mut [String]) {
+        texts.par_iter_mut().for_each(|text| {
+            if let Cow::Owned(replaced) = self.sanitize_cow(text) {
+                *text = replaced;
+            }
+        });
     }
 
     pub fn detect_sensitive_data(&self, text: &str) -> Vec<SensitiveDataMatch> {
+        // Detection covers the categories that make text unsafe for
+        // training: keys, passwords, emails, and credit cards
+        const DETECTED: [SensitiveDataType; 4] = [
+            SensitiveDataType::ApiKey,
+            SensitiveDataType::Password,
+            SensitiveDataType::Email,
+            SensitiveDataType::CreditCard,
+        ];
+
         let mut matches = Vec::new();
 
-        // Check for API keys
-        for pattern in API_KEY_PATTERNS.iter() {
-            for mat in pattern.find_iter(text) {
-                matches.push(SensitiveDataMatch {
-                    data_type: SensitiveDataType::ApiKey,
-                    position: mat.start(),
-                    length: mat.len(),
-                });
+        for idx in ENGINE.set.matches(text).iter() {
+            let rule = &RULES[idx];
+            if !DETECTED.contains(&rule.data_type) {
+                continue;
             }
-        }
 
-        // Check for passwords
-        for pattern in PASSWORD_PATTERNS.iter() {
-            for mat in pattern.find_iter(text) {
+            for mat in ENGINE.regexes[idx].find_iter(text) {
                 matches.push(SensitiveDataMatch {
-                    data_type: SensitiveDataType::Password,
+                    data_type: rule.data_type.clone(),
                     position: mat.start(),
                     length: mat.len(),
                 });
             }
         }
 
-        // Check for emails
-        for mat in EMAIL_REGEX.find_iter(text) {
-            matches.push(SensitiveDataMatch {
-                data_type: SensitiveDataType::Email,
-                position: mat.start(),
-                length: mat.len(),
-            });
-        }
-
-        // Check for credit cards
-        for mat in CREDIT_CARD_REGEX.find_iter(text) {
-            matches.push(SensitiveDataMatch {
-                data_type: SensitiveDataType::CreditCard,
-                position: mat.start(),
-                length: mat.len(),
-            });
-        }
-
         matches
     }
 
@@ -270,4 +273,23 @@ mod tests {
         assert!(result.contains("/home/[USER]"));
         assert!(!result.contains("/home/john"));
     }
+
+    #[test]
+    fn test_clean_text_borrows() {
+        let sanitizer = Sanitizer::new();
+        let text = "nothing sensitive here";
+        assert!(matches!(sanitizer.sanitize_cow(text), Cow::Borrowed(_)));
+    }
+
+    #[test]
+    fn test_sanitize_many() {
+        let sanitizer = Sanitizer::new();
+        let mut texts = vec![
+            "key sk-1234567890abcdefghij".to_string(),
+            "clean".to_string(),
+        ];
+        sanitizer.sanitize_many(&mut texts);
+        assert!(texts[0].contains("[REDACTED_API_KEY]"));
+        assert_eq!(texts[1], "clean");
+    }
 }
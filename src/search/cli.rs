@@ -69,14 +69,28 @@ pub struct SearchArgs {
     /// Update index before searching
     #[arg(long)]
     pub update: bool,
+
+    /// Number of indexing threads (default: one per core, capped at 8)
+    #[arg(long)]
+    pub index_threads: Option<usize>,
+
+    /// Total index writer memory budget in MB (default: 500)
+    #[arg(long)]
+    pub index_mem_mb: Option<usize>,
 }
 
-/// Handles the search command
-pub fn handle_search(args: SearchArgs) -> Result<()> {
-    let cache_dir = dirs::cache_dir()
+/// Default on-disk location of the search index, shared with the daemon's
+/// background index refresher
+pub fn default_index_dir() -> Result<PathBuf> {
+    Ok(dirs::cache_dir()
         .context("Could not determine cache directory")?
         .join("vibedev")
-        .join("search_index");
+        .join("search_index"))
+}
+
+/// Handles the search command
+pub fn handle_search(args: SearchArgs) -> Result<()> {
+    let cache_dir = default_index_dir()?;
 
     let metadata_path = cache_dir.join("metadata.json");
 
@@ -86,10 +100,14 @@ pub fn handle_search(args: SearchArgs) -> Result<()> {
     // Build or update index
     if args.rebuild || !index_exists {
         println!("{}", "🔍 No search index found. Building index...".yellow());
-        let mut builder = IndexBuilder::new(&cache_dir)?;
+        let mut builder = IndexBuilder::new(&cache_dir)?
+            .with_threads(args.index_threads)
+            .with_memory_budget_mb(args.index_mem_mb);
         builder.build_initial_index()?;
     } else if args.update {
-        let mut builder = IndexBuilder::new(&cache_dir)?;
+        let mut builder = IndexBuilder::new(&cache_dir)?
+            .with_threads(args.index_threads)
+            .with_memory_budget_mb(args.index_mem_mb);
         builder.update_index()?;
     } else {
         // Show index info
@@ -146,6 +164,8 @@ pub fn handle_search(args: SearchArgs) -> Result<()> {
         regex: args.regex,
         limit: args.limit,
         offset: args.offset,
+        after: None,
+        selected_fields: None,
         format,
         context: args.context,
     };
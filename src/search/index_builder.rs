@@ -1,6 +1,9 @@
 use anyhow::{Context, Result};
 use colored::*;
 use indicatif::{ProgressBar, ProgressStyle};
+use rayon::prelude::*;
+use std::collections::HashSet;
+use std::io::{BufRead, BufReader, Read, Seek, SeekFrom};
 use std::path::{Path, PathBuf};
 use std::sync::atomic::{AtomicU64, Ordering};
 use std::sync::Arc;
@@ -8,6 +11,7 @@ use tantivy::collector::TopDocs;
 use tantivy::query::QueryParser;
 use tantivy::schema::*;
 use tantivy::{doc, Index, IndexWriter};
+use tracing::info_span;
 
 use crate::discovery::LogDiscovery;
 use crate::models::{DiscoveryFindings, LogLocation};
@@ -18,12 +22,17 @@ use crate::parsers::cursor::CursorParser;
 use crate::parsers::generic::GenericParser;
 use crate::parsers::LogParser;
 
-use super::metadata::{detect_changes, IndexMetadata, LocationMetadata};
+use super::metadata::{
+    detect_file_changes, fingerprint_files, FileFingerprint, IndexMetadata, LocationMetadata,
+};
 use super::schema::{build_schema, LogEntryDocument, FIELD_FILE_PATH};
 
-const BATCH_SIZE: usize = 10_000;
 const MEMORY_BUDGET_MB: usize = 500;
 
+/// Commit after this many files so writer memory stays bounded and a
+/// crash loses at most one chunk instead of the whole build
+const COMMIT_CHUNK_FILES: usize = 256;
+
 /// Statistics about indexing operation
 #[derive(Debug, Clone)]
 pub struct IndexStats {
@@ -40,6 +49,8 @@ pub struct IndexBuilder {
     metadata_path: PathBuf,
     index: Index,
     schema: Schema,
+    index_threads: Option<usize>,
+    index_mem_mb: usize,
 }
 
 impl IndexBuilder {
@@ -64,11 +75,34 @@ impl IndexBuilder {
             metadata_path,
             index,
             schema,
+            index_threads: None,
+            index_mem_mb: MEMORY_BUDGET_MB,
         })
     }
 
+    /// Number of indexing threads (default: one per core, capped at 8)
+    pub fn with_threads(mut self, threads: Option<usize>) -> Self {
+        self.index_threads = threads;
+        self
+    }
+
+    /// Total writer memory budget in MB, split across indexing threads
+    pub fn with_memory_budget_mb(mut self, mem_mb: Option<usize>) -> Self {
+        if let Some(mem_mb) = mem_mb {
+            self.index_mem_mb = mem_mb;
+        }
+        self
+    }
+
+    fn num_threads(&self) -> usize {
+        self.index_threads
+            .unwrap_or_else(|| rayon::current_num_threads().min(8))
+            .max(1)
+    }
+
     /// Builds the initial index from discovered logs
     pub fn build_initial_index(&mut self) -> Result<IndexStats> {
+        let _span = info_span!("build_initial_index").entered();
         let start = std::time::Instant::now();
 
         println!("\n{}", "📊 Discovering logs...".cyan());
@@ -76,7 +110,10 @@ impl IndexBuilder {
         // Run discovery
         let home_dir = dirs::home_dir().context("Could not determine home directory")?;
         let discovery = LogDiscovery::new(home_dir, true);
-        let findings = discovery.scan()?;
+        let findings = {
+            let _span = info_span!("discovery_scan").entered();
+            discovery.scan_cached()?
+        };
 
         println!(
             "   Found: {} tools, {} locations, {}",
@@ -88,9 +125,14 @@ impl IndexBuilder {
         println!("\n{}", "🏗️  Building search index...".green().bold());
 
         // Index all locations
-        let stats = self.index_locations(&findings.locations, true)?;
+        let stats = {
+            let _span =
+                info_span!("index_locations", bytes = findings.total_size_bytes).entered();
+            self.index_locations(&findings.locations, true)?
+        };
 
         // Save metadata
+        let meta_span = info_span!("save_metadata").entered();
         let mut metadata = IndexMetadata::new();
         for location in &findings.locations {
             if let Ok(loc_meta) = LocationMetadata::from_log_location(location) {
@@ -99,6 +141,7 @@ impl IndexBuilder {
         }
         metadata.update_total_docs();
         metadata.save(&self.metadata_path)?;
+        drop(meta_span);
 
         let elapsed = start.elapsed().as_secs_f64();
         let mut final_stats = stats;
@@ -112,6 +155,7 @@ impl IndexBuilder {
 
     /// Updates the index with new/changed logs
     pub fn update_index(&mut self) -> Result<IndexStats> {
+        let _span = info_span!("update_index").entered();
         let start = std::time::Instant::now();
 
         println!("\n{}", "🔄 Checking for updates...".cyan());
@@ -126,12 +170,31 @@ impl IndexBuilder {
         // Run discovery
         let home_dir = dirs::home_dir().context("Could not determine home directory")?;
         let discovery = LogDiscovery::new(home_dir, true);
-        let findings = discovery.scan()?;
+        let findings = {
+            let _span = info_span!("discovery_scan").entered();
+            discovery.scan_cached()?
+        };
 
-        // Detect changes
-        let changed = detect_changes(&metadata, &findings.locations)?;
+        // Diff each location at file granularity against the recorded
+        // fingerprints, so the work below is proportional to what actually
+        // moved on disk, not to corpus size
+        let mut work = Vec::new();
+        {
+            let _span = info_span!("diff_fingerprints").entered();
+            for location in &findings.locations {
+                let current = fingerprint_files(&location.path);
+                let prev = metadata.find_location(&location.path).cloned();
+                let prev_files: &[FileFingerprint] =
+                    prev.as_ref().map(|p| p.files.as_slice()).unwrap_or(&[]);
+
+                let changes = detect_file_changes(prev_files, &current);
+                if !changes.is_empty() {
+                    work.push((location.clone(), prev, changes, current));
+                }
+            }
+        }
 
-        if changed.is_empty() {
+        if work.is_empty() {
             println!("   {}", "No changes detected".green());
             return Ok(IndexStats {
                 total_docs: metadata.total_docs,
@@ -146,32 +209,103 @@ impl IndexBuilder {
             });
         }
 
+        let (changed_count, appended_count): (usize, usize) = work
+            .iter()
+            .fold((0, 0), |(c, a), (_, _, changes, _)| {
+                (
+                    c + changes.changed.len() + changes.removed.len(),
+                    a + changes.appended.len(),
+                )
+            });
         println!(
-            "   Found {} new/changed files",
-            changed.len().to_string().yellow()
+            "   Found {} new/changed files, {} with appended data",
+            changed_count.to_string().yellow(),
+            appended_count.to_string().yellow()
         );
 
-        // Delete old docs for changed locations
-        self.delete_docs_by_paths(&changed)?;
-
-        // Reindex changed locations
-        let stats = self.index_locations(&changed, false)?;
-
-        // Update metadata
         let mut updated_metadata = metadata;
-        for location in &changed {
-            if let Ok(mut loc_meta) = LocationMetadata::from_log_location(location) {
-                loc_meta.doc_count = stats.total_docs;
-                updated_metadata.upsert_location(loc_meta);
+        let mut total_docs = 0u64;
+        let mut total_files = 0usize;
+        let mut total_bytes = 0u64;
+
+        for (location, prev, mut changes, mut current) in work {
+            let _span = info_span!(
+                "reindex_location",
+                path = %location.path.display(),
+                bytes = location.size_bytes
+            )
+            .entered();
+
+            // The appended fast path parses Claude history entries
+            // specifically; grown JSONL owned by other tools (e.g. Cline's
+            // history.jsonl) must go through its own parser, so demote it
+            // to a full per-file reindex
+            if location.tool != crate::models::AiTool::ClaudeCode {
+                changes
+                    .changed
+                    .extend(changes.appended.drain(..).map(|(path, _)| path));
             }
+
+            // Drop stale docs at file granularity. Metadata written before
+            // file-level tracking keyed docs by the location path, so that
+            // key is removed too when upgrading such an entry.
+            let mut stale: Vec<PathBuf> = changes
+                .changed
+                .iter()
+                .chain(changes.removed.iter())
+                .cloned()
+                .collect();
+            if prev.as_ref().map_or(false, |p| p.files.is_empty()) {
+                stale.push(location.path.clone());
+            }
+            self.delete_docs_by_paths(&stale)?;
+
+            // Fully reindex new/rewritten files
+            let changed_locations: Vec<LogLocation> = changes
+                .changed
+                .iter()
+                .map(|path| LogLocation {
+                    path: path.clone(),
+                    ..location.clone()
+                })
+                .collect();
+            let stats = self.index_locations(&changed_locations, false)?;
+
+            // Index only the appended suffix of append-only JSONL files;
+            // the consumed offsets are written back into `current`
+            let appended_docs =
+                self.index_appended_jsonl(&location, &changes.appended, &mut current)?;
+
+            let docs_added = stats.total_docs + appended_docs;
+            total_docs += docs_added;
+            total_files += changes.changed.len() + changes.appended.len();
+            total_bytes += stats.total_bytes;
+
+            let mut loc_meta = LocationMetadata::from_log_location(&location)?;
+            // Record exactly the state we diffed against, so concurrent
+            // writes after the fingerprint pass are picked up next run
+            loc_meta.files = current;
+            // Approximate: deletions of rewritten files are not individually
+            // counted, matching the pre-existing doc_count bookkeeping
+            loc_meta.doc_count = match prev {
+                Some(p) if !p.files.is_empty() => p.doc_count + docs_added,
+                _ => docs_added,
+            };
+            updated_metadata.upsert_location(loc_meta);
         }
+
         updated_metadata.last_indexed = chrono::Utc::now();
         updated_metadata.update_total_docs();
         updated_metadata.save(&self.metadata_path)?;
 
         let elapsed = start.elapsed().as_secs_f64();
-        let mut final_stats = stats;
-        final_stats.duration_secs = elapsed;
+        let final_stats = IndexStats {
+            total_docs,
+            total_files,
+            total_bytes,
+            index_size_bytes: self.get_index_size()?,
+            duration_secs: elapsed,
+        };
 
         self.print_stats(&final_stats);
 
@@ -184,8 +318,24 @@ impl IndexBuilder {
         locations: &[LogLocation],
         show_progress: bool,
     ) -> Result<IndexStats> {
-        let total_files = locations.len();
-        let total_bytes: u64 = locations.iter().map(|l| l.size_bytes).sum();
+        // Flatten locations into the individual files beneath them:
+        // documents are keyed by the file that produced them, which is what
+        // lets update_index delete and reindex at file granularity.
+        // Overlapping search patterns can surface the same file under two
+        // locations, so dedupe by path.
+        let mut seen = HashSet::new();
+        let files: Vec<(&LogLocation, FileFingerprint)> = locations
+            .iter()
+            .flat_map(|location| {
+                fingerprint_files(&location.path)
+                    .into_iter()
+                    .map(move |file| (location, file))
+            })
+            .filter(|(_, file)| seen.insert(file.path.clone()))
+            .collect();
+
+        let total_files = files.len();
+        let total_bytes: u64 = files.iter().map(|(_, f)| f.size_bytes).sum();
 
         // Create progress bar
         let pb = if show_progress {
@@ -203,17 +353,19 @@ impl IndexBuilder {
             None
         };
 
-        // Create index writer
+        // Create index writer: the budget is split across worker threads,
+        // so per-thread heap stays fixed regardless of conversation size
+        let num_threads = self.num_threads();
         let mut writer: IndexWriter<TantivyDocument> = self
             .index
-            .writer(MEMORY_BUDGET_MB * 1_024 * 1_024)
+            .writer_with_num_threads(num_threads, self.index_mem_mb * 1_024 * 1_024)
             .context("Failed to create index writer")?;
 
         // Track stats
         let doc_counter = Arc::new(AtomicU64::new(0));
         let doc_id_counter = Arc::new(AtomicU64::new(self.get_current_max_doc_id()? + 1));
 
-        // Parsers chain
+        // Parsers chain (shared read-only across workers)
         let parsers: Vec<Box<dyn LogParser>> = vec![
             Box::new(ClaudeParser),
             Box::new(ClineParser),
@@ -221,73 +373,58 @@ impl IndexBuilder {
             Box::new(GenericParser),
         ];
 
-        let mut bytes_processed = 0u64;
-
-        for location in locations {
-            // Try each parser
-            let parsed = parsers
-                .iter()
-                .find_map(|parser| {
-                    if parser.can_parse(&location.path) {
-                        parser.parse(&location.path).ok()
+        let bytes_processed = Arc::new(AtomicU64::new(0));
+
+        // Shard files across workers: parsing (the expensive part) runs
+        // concurrently and documents flow into the writer's own thread pool.
+        // Committing per chunk bounds writer memory and amortizes commit cost
+        // instead of one giant commit at the end.
+        for chunk in files.chunks(COMMIT_CHUNK_FILES) {
+            chunk.par_iter().try_for_each(|(location, file)| -> Result<()> {
+                let parsed = parsers.iter().find_map(|parser| {
+                    if parser.can_parse(&file.path) {
+                        parser.parse(&file.path).ok()
                     } else {
                         None
                     }
                 });
 
-            if let Some(parsed_log) = parsed {
-                // Index entries in batches
-                let mut batch = Vec::new();
-
-                for entry in &parsed_log.entries {
-                    let doc_id = doc_id_counter.fetch_add(1, Ordering::SeqCst);
-
-                    let log_entry_doc = LogEntryDocument::from_log_entry(
-                        entry,
-                        doc_id,
-                        &parsed_log.tool,
-                        &format!("{:?}", location.log_type),
-                        &location.path,
-                    );
-
-                    batch.push(log_entry_doc);
-
-                    // Commit batch
-                    if batch.len() >= BATCH_SIZE {
-                        for doc in &batch {
-                            writer.add_document(doc.to_tantivy_document(&self.schema))?;
-                        }
-                        doc_counter.fetch_add(batch.len() as u64, Ordering::SeqCst);
-                        batch.clear();
+                if let Some(parsed_log) = parsed {
+                    for entry in &parsed_log.entries {
+                        let doc_id = doc_id_counter.fetch_add(1, Ordering::SeqCst);
+
+                        let log_entry_doc = LogEntryDocument::from_log_entry(
+                            entry,
+                            doc_id,
+                            &parsed_log.tool,
+                            &format!("{:?}", location.log_type),
+                            &file.path,
+                        );
+
+                        writer.add_document(log_entry_doc.to_tantivy_document(&self.schema))?;
+                        doc_counter.fetch_add(1, Ordering::SeqCst);
                     }
                 }
 
-                // Commit remaining
-                if !batch.is_empty() {
-                    for doc in &batch {
-                        writer.add_document(doc.to_tantivy_document(&self.schema))?;
-                    }
-                    doc_counter.fetch_add(batch.len() as u64, Ordering::SeqCst);
+                let processed =
+                    bytes_processed.fetch_add(file.size_bytes, Ordering::SeqCst)
+                        + file.size_bytes;
+
+                if let Some(ref pb) = pb {
+                    pb.inc(1);
+                    pb.set_message(format_bytes(processed));
                 }
-            }
 
-            bytes_processed += location.size_bytes;
+                Ok(())
+            })?;
 
-            if let Some(ref pb) = pb {
-                pb.inc(1);
-                pb.set_message(format_bytes(bytes_processed));
-            }
+            writer.commit().context("Failed to commit index chunk")?;
         }
 
         if let Some(pb) = pb {
             pb.finish_with_message("Done!");
         }
 
-        // Commit index
-        writer
-            .commit()
-            .context("Failed to commit index")?;
-
         let total_docs = doc_counter.load(Ordering::SeqCst);
         let index_size = self.get_index_size()?;
 
@@ -301,15 +438,19 @@ impl IndexBuilder {
     }
 
     /// Deletes documents by file paths (for incremental updates)
-    fn delete_docs_by_paths(&mut self, locations: &[LogLocation]) -> Result<()> {
+    fn delete_docs_by_paths(&mut self, paths: &[PathBuf]) -> Result<()> {
+        if paths.is_empty() {
+            return Ok(());
+        }
+
         let mut writer: IndexWriter<TantivyDocument> = self
             .index
-            .writer(MEMORY_BUDGET_MB * 1_024 * 1_024)?;
+            .writer(self.index_mem_mb * 1_024 * 1_024)?;
 
         let file_path_field = self.schema.get_field(FIELD_FILE_PATH)?;
 
-        for location in locations {
-            let path_str = location.path.to_string_lossy().to_string();
+        for path in paths {
+            let path_str = path.to_string_lossy().to_string();
             let term = Term::from_field_text(file_path_field, &path_str);
             writer.delete_term(term);
         }
@@ -318,6 +459,89 @@ impl IndexBuilder {
         Ok(())
     }
 
+    /// Indexes only the suffix of append-only JSONL files, starting from the
+    /// byte offset recorded at the previous index run. Only Claude locations
+    /// take this path — the lines are parsed as Claude history entries — and
+    /// `update_index` demotes other tools' grown JSONL to a full reindex.
+    ///
+    /// Reads are capped at the fingerprinted size, and each file's
+    /// `indexed_offset` in `current` is advanced only to the end of the last
+    /// newline-terminated line consumed. Bytes appended after the fingerprint
+    /// pass, and a partially written trailing line, therefore stay beyond the
+    /// recorded offset and are indexed exactly once on a later update.
+    fn index_appended_jsonl(
+        &mut self,
+        location: &LogLocation,
+        appended: &[(PathBuf, u64)],
+        current: &mut [FileFingerprint],
+    ) -> Result<u64> {
+        if appended.is_empty() {
+            return Ok(0);
+        }
+
+        let mut writer: IndexWriter<TantivyDocument> = self
+            .index
+            .writer(self.index_mem_mb * 1_024 * 1_024)?;
+
+        let mut doc_id = self.get_current_max_doc_id()? + 1;
+        let mut added = 0u64;
+        let log_type = format!("{:?}", location.log_type);
+
+        for (path, offset) in appended {
+            let Some(fingerprint) = current.iter_mut().find(|f| &f.path == path) else {
+                continue;
+            };
+
+            let mut file = std::fs::File::open(path)
+                .with_context(|| format!("Failed to open {}", path.display()))?;
+            file.seek(SeekFrom::Start(*offset))?;
+            let cap = fingerprint.size_bytes.saturating_sub(*offset);
+            let mut reader = BufReader::new(file.take(cap));
+
+            let mut consumed = 0u64;
+            let mut line = String::new();
+            loop {
+                line.clear();
+                let n = reader.read_line(&mut line)?;
+                if n == 0 {
+                    break;
+                }
+                if !line.ends_with('\n') {
+                    // Partial trailing line: leave it before the offset so
+                    // it is re-read whole once the writer finishes it
+                    break;
+                }
+                consumed += n as u64;
+
+                if line.trim().is_empty() {
+                    continue;
+                }
+                let Ok(json) = serde_json::from_str::<serde_json::Value>(&line) else {
+                    continue;
+                };
+                let Some(entry) = crate::parsers::claude::parse_history_entry(&json) else {
+                    continue;
+                };
+
+                let log_entry_doc = LogEntryDocument::from_log_entry(
+                    &entry,
+                    doc_id,
+                    &location.tool,
+                    &log_type,
+                    path,
+                );
+                writer.add_document(log_entry_doc.to_tantivy_document(&self.schema))?;
+                doc_id += 1;
+                added += 1;
+            }
+
+            fingerprint.indexed_offset = offset + consumed;
+        }
+
+        writer.commit()?;
+        Ok(added)
+    }
+
     /// Gets the current maximum doc_id in the index
     fn get_current_max_doc_id(&self) -> Result<u64> {
         let reader = self.index.reader()?;
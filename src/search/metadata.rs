@@ -45,6 +45,109 @@ pub struct LocationMetadata {
 
     /// Number of documents indexed from this location
     pub doc_count: u64,
+
+    /// Per-file fingerprints, the granularity at which updates reindex.
+    /// Defaults to empty for metadata written before file-level tracking,
+    /// which forces one full reindex of the location.
+    #[serde(default)]
+    pub files: Vec<FileFingerprint>,
+}
+
+/// Fingerprint of one indexed file: (path, mtime, size) decides whether it
+/// changed, and `indexed_offset` lets append-only JSONL files be indexed
+/// from the previous end instead of from scratch.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct FileFingerprint {
+    pub path: PathBuf,
+    pub mtime: DateTime<Utc>,
+    pub size_bytes: u64,
+
+    /// Bytes of this file already represented in the index
+    pub indexed_offset: u64,
+}
+
+/// File-level difference between the previous index state and disk
+#[derive(Debug, Default)]
+pub struct FileChangeSet {
+    /// JSONL files that only grew: (path, offset to resume indexing from)
+    pub appended: Vec<(PathBuf, u64)>,
+
+    /// New files, rewritten files, or files that shrank: full reindex
+    pub changed: Vec<PathBuf>,
+
+    /// Files that disappeared since the last index
+    pub removed: Vec<PathBuf>,
+}
+
+impl FileChangeSet {
+    pub fn is_empty(&self) -> bool {
+        self.appended.is_empty() && self.changed.is_empty() && self.removed.is_empty()
+    }
+}
+
+/// Collect fingerprints for every file under a location (a location may be
+/// a single file or a directory tree)
+pub fn fingerprint_files(location_path: &Path) -> Vec<FileFingerprint> {
+    if location_path.is_file() {
+        return fingerprint_one(location_path).into_iter().collect();
+    }
+
+    walkdir::WalkDir::new(location_path)
+        .follow_links(false)
+        .into_iter()
+        .filter_map(|e| e.ok())
+        .filter(|e| e.file_type().is_file())
+        .filter_map(|e| fingerprint_one(e.path()))
+        .collect()
+}
+
+fn fingerprint_one(path: &Path) -> Option<FileFingerprint> {
+    let metadata = fs::metadata(path).ok()?;
+    Some(FileFingerprint {
+        path: path.to_path_buf(),
+        mtime: metadata.modified().ok()?.into(),
+        size_bytes: metadata.len(),
+        indexed_offset: metadata.len(),
+    })
+}
+
+/// Diff previous file fingerprints against the current on-disk state.
+/// JSONL files that only grew become `appended` with their old offset, so
+/// steady-state updates cost work proportional to the new bytes; anything
+/// else that moved becomes a full per-file reindex.
+pub fn detect_file_changes(
+    previous: &[FileFingerprint],
+    current: &[FileFingerprint],
+) -> FileChangeSet {
+    let prev: HashMap<&PathBuf, &FileFingerprint> =
+        previous.iter().map(|f| (&f.path, f)).collect();
+
+    let mut changes = FileChangeSet::default();
+
+    for file in current {
+        match prev.get(&file.path) {
+            Some(p) if p.mtime == file.mtime && p.size_bytes == file.size_bytes => {
+                // Unchanged
+            }
+            Some(p)
+                if file.size_bytes > p.indexed_offset
+                    && file.path.extension().and_then(|e| e.to_str()) == Some("jsonl") =>
+            {
+                changes.appended.push((file.path.clone(), p.indexed_offset));
+            }
+            Some(_) => changes.changed.push(file.path.clone()),
+            None => changes.changed.push(file.path.clone()),
+        }
+    }
+
+    let current_paths: HashMap<&PathBuf, ()> = current.iter().map(|f| (&f.path, ())).collect();
+    for file in previous {
+        if !current_paths.contains_key(&file.path) {
+            changes.removed.push(file.path.clone());
+        }
+    }
+
+    changes
 }
 
 impl IndexMetadata {
@@ -118,7 +221,7 @@ impl Default for IndexMetadata {
 }
 
 impl LocationMetadata {
-    /// Creates metadata from a LogLocation
+    /// Creates metadata from a LogLocation, fingerprinting its files
     pub fn from_log_location(location: &LogLocation) -> Result<Self> {
         let hash = compute_location_hash(&location.path)?;
         let last_modified = fs::metadata(&location.path)?
@@ -131,22 +234,9 @@ impl LocationMetadata {
             size_bytes: location.size_bytes,
             last_modified,
             doc_count: 0,  // Will be updated during indexing
+            files: fingerprint_files(&location.path),
         })
     }
-
-    /// Checks if this location has changed compared to current state
-    pub fn has_changed(&self) -> Result<bool> {
-        // Check if file still exists
-        if !self.path.exists() {
-            return Ok(true);
-        }
-
-        // Compute current hash
-        let current_hash = compute_location_hash(&self.path)?;
-
-        // Compare hashes
-        Ok(current_hash != self.hash)
-    }
 }
 
 /// Computes a hash for a log location to detect changes
@@ -158,6 +248,14 @@ pub fn compute_location_hash(path: &Path) -> Result<String> {
     let metadata = fs::metadata(path).context("Failed to read file metadata")?;
     let last_modified: DateTime<Utc> = metadata.modified()?.into();
 
+    // Directory locations hash on path + mtime; their contents are tracked
+    // at file granularity via fingerprints
+    if metadata.is_dir() {
+        hasher.update(path.to_string_lossy().as_bytes());
+        hasher.update(last_modified.to_rfc3339().as_bytes());
+        return Ok(format!("{:x}", hasher.finalize()));
+    }
+
     // Read first 1MB of file (or whole file if smaller)
     let max_bytes = 1_048_576; // 1MB
     let file = File::open(path).context("Failed to open file for hashing")?;
@@ -173,37 +271,6 @@ pub fn compute_location_hash(path: &Path) -> Result<String> {
     Ok(format!("{:x}", result))
 }
 
-/// Detects which locations have changed since the last index
-pub fn detect_changes(
-    metadata: &IndexMetadata,
-    discovered_locations: &[LogLocation],
-) -> Result<Vec<LogLocation>> {
-    let mut changed = Vec::new();
-
-    // Build a map of existing locations for fast lookup
-    let existing: HashMap<PathBuf, &LocationMetadata> = metadata
-        .indexed_locations
-        .iter()
-        .map(|loc| (loc.path.clone(), loc))
-        .collect();
-
-    for location in discovered_locations {
-        let needs_reindex = if let Some(existing_loc) = existing.get(&location.path) {
-            // Check if it has changed
-            existing_loc.has_changed().unwrap_or(true)
-        } else {
-            // New location
-            true
-        };
-
-        if needs_reindex {
-            changed.push(location.clone());
-        }
-    }
-
-    Ok(changed)
-}
-
 #[cfg(test)]
 mod tests {
     use super::*;
@@ -276,6 +343,7 @@ mod tests {
             size_bytes: 100,
             last_modified: Utc::now(),
             doc_count: 10,
+            files: Vec::new(),
         };
 
         // Add new location
@@ -300,6 +368,7 @@ mod tests {
             size_bytes: 100,
             last_modified: Utc::now(),
             doc_count: 50,
+            files: Vec::new(),
         });
 
         metadata.indexed_locations.push(LocationMetadata {
@@ -308,6 +377,7 @@ mod tests {
             size_bytes: 200,
             last_modified: Utc::now(),
             doc_count: 75,
+            files: Vec::new(),
         });
 
         metadata.update_total_docs();
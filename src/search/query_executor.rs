@@ -2,11 +2,15 @@ use anyhow::{Context, Result};
 use chrono::{DateTime, NaiveDate, Utc};
 use comfy_table::{modifiers::UTF8_ROUND_CORNERS, presets::UTF8_FULL, Cell, Color, Table};
 use serde::{Deserialize, Serialize};
+use std::cmp::Reverse;
 use std::path::Path;
 use tantivy::collector::TopDocs;
 use tantivy::query::{BooleanQuery, Occur, Query, QueryParser, RegexQuery, TermQuery};
 use tantivy::schema::*;
-use tantivy::{Index, TantivyDocument};
+use tantivy::{
+    DocAddress, DocId, Index, IndexReader, ReloadPolicy, Score, Searcher, SegmentReader,
+    TantivyDocument,
+};
 
 use super::schema::*;
 
@@ -46,6 +50,16 @@ pub struct SearchQuery {
     /// Offset for pagination
     pub offset: usize,
 
+    /// Cursor from a previous page; when set, `offset` is ignored and
+    /// only hits strictly after the cursor are collected, so deep pages
+    /// cost the same as the first one
+    pub after: Option<SearchCursor>,
+
+    /// When set, only these stored fields are materialized into the
+    /// results (doc_id and score always are); callers rendering just
+    /// path + snippet skip copying full message bodies
+    pub selected_fields: Option<Vec<String>>,
+
     /// Output format
     pub format: OutputFormat,
 
@@ -53,6 +67,14 @@ pub struct SearchQuery {
     pub context: usize,
 }
 
+/// Opaque pagination cursor: the sort key (score, doc_id) of the last
+/// hit on the previous page
+#[derive(Debug, Clone, Copy, Serialize, Deserialize)]
+pub struct SearchCursor {
+    pub score: f32,
+    pub doc_id: u64,
+}
+
 #[derive(Debug, Clone, Copy)]
 pub enum OutputFormat {
     Table,
@@ -74,6 +96,8 @@ impl Default for SearchQuery {
             regex: false,
             limit: 100,
             offset: 0,
+            after: None,
+            selected_fields: None,
             format: OutputFormat::Table,
             context: 0,
         }
@@ -104,12 +128,20 @@ pub struct SearchResults {
     pub offset: usize,
     pub results: Vec<SearchResult>,
     pub search_time_ms: u64,
+
+    /// Cursor for the next page, present when this page was full
+    pub next_cursor: Option<SearchCursor>,
 }
 
-/// Executes search queries against the Tantivy index
+/// Executes search queries against the Tantivy index.
+///
+/// The executor is meant to be long-lived: it holds one IndexReader that
+/// reloads on commit, so repeated queries reuse warm segment readers
+/// instead of re-opening the index each time.
 pub struct QueryExecutor {
     index: Index,
     schema: Schema,
+    reader: IndexReader,
 }
 
 impl QueryExecutor {
@@ -118,39 +150,74 @@ impl QueryExecutor {
         let schema = build_schema();
         let index = Index::open_in_dir(index_path).context("Failed to open index")?;
 
-        Ok(Self { index, schema })
+        // Cached reader: picks up new commits automatically, no reopen
+        // cost on the query path
+        let reader = index
+            .reader_builder()
+            .reload_policy(ReloadPolicy::OnCommitWithDelay)
+            .try_into()?;
+
+        Ok(Self {
+            index,
+            schema,
+            reader,
+        })
     }
 
     /// Executes a search query
     pub fn execute(&self, query: &SearchQuery) -> Result<SearchResults> {
         let start = std::time::Instant::now();
 
-        let reader = self.index.reader()?;
-
-        let searcher = reader.searcher();
+        let searcher = self.reader.searcher();
 
         // Build the query
         let tantivy_query = self.build_query(query)?;
 
-        // Execute search
-        let top_docs = searcher.search(
-            &*tantivy_query,
-            &TopDocs::with_limit(query.limit + query.offset),
-        )?;
-
-        // Skip offset
-        let results_to_show: Vec<_> = top_docs.into_iter().skip(query.offset).collect();
+        // Execute search. Every page runs through the same tweaked-key
+        // collector so all pages share one total order on
+        // (score desc, doc_id asc); plain TopDocs tie-breaks by DocAddress,
+        // which no longer matches doc_id order under parallel indexing. The
+        // first page uses a sentinel cursor that sorts above every real hit.
+        let results_to_show: Vec<(Score, DocAddress)> = if let Some(cursor) = query.after {
+            self.search_after(&searcher, &*tantivy_query, cursor, query.limit)?
+        } else {
+            let sentinel = SearchCursor {
+                score: f32::INFINITY,
+                doc_id: 0,
+            };
+            self.search_after(
+                &searcher,
+                &*tantivy_query,
+                sentinel,
+                query.limit + query.offset,
+            )?
+            .into_iter()
+            .skip(query.offset)
+            .collect()
+        };
 
         // Convert to SearchResult
+        let selected = query.selected_fields.as_deref();
         let mut results = Vec::new();
         for (score, doc_address) in results_to_show {
             let retrieved_doc = searcher.doc(doc_address)?;
-            let result = self.doc_to_search_result(&retrieved_doc, score)?;
+            let result = self.doc_to_search_result(&retrieved_doc, score, selected)?;
             results.push(result);
         }
 
         let search_time_ms = start.elapsed().as_millis() as u64;
 
+        // A full page may have more behind it; hand back a cursor so the
+        // next page can skip inside the collector
+        let next_cursor = if results.len() == query.limit {
+            results.last().map(|r| SearchCursor {
+                score: r.score,
+                doc_id: r.doc_id,
+            })
+        } else {
+            None
+        };
+
         Ok(SearchResults {
             query: query.text.clone(),
             total_found: results.len(),
@@ -158,9 +225,52 @@ impl QueryExecutor {
             offset: query.offset,
             results,
             search_time_ms,
+            next_cursor,
         })
     }
 
+    /// Collects the top `limit` hits strictly after `cursor` in
+    /// (score desc, doc_id asc) order. Docs at or before the cursor are
+    /// sunk below every real hit inside the collector, so earlier pages
+    /// are never re-collected or re-retrieved. First pages pass a
+    /// `(f32::INFINITY, 0)` sentinel, which sorts above every real hit,
+    /// so the same total order applies to all pages.
+    fn search_after(
+        &self,
+        searcher: &Searcher,
+        query: &dyn Query,
+        cursor: SearchCursor,
+        limit: usize,
+    ) -> Result<Vec<(Score, DocAddress)>> {
+        let cursor_key = (cursor.score, Reverse(cursor.doc_id));
+
+        let collector = TopDocs::with_limit(limit).tweak_score(move |segment: &SegmentReader| {
+            let doc_ids = segment
+                .fast_fields()
+                .u64(FIELD_DOC_ID)
+                .expect("doc_id is declared FAST in the schema");
+
+            move |doc: DocId, score: Score| {
+                let id = doc_ids.first(doc).unwrap_or(u64::MAX);
+                let key = (score, Reverse(id));
+                if key >= cursor_key {
+                    // At or before the cursor
+                    (f32::NEG_INFINITY, Reverse(u64::MAX))
+                } else {
+                    key
+                }
+            }
+        });
+
+        let top_docs = searcher.search(query, &collector)?;
+
+        Ok(top_docs
+            .into_iter()
+            .filter(|((score, _), _)| *score != f32::NEG_INFINITY)
+            .map(|((score, _), addr)| (score, addr))
+            .collect())
+    }
+
     /// Builds a Tantivy query from SearchQuery
     fn build_query(&self, query: &SearchQuery) -> Result<Box<dyn Query>> {
         let message_field = self.schema.get_field(FIELD_MESSAGE)?;
@@ -226,69 +336,60 @@ impl QueryExecutor {
         }
     }
 
-    /// Converts a Tantivy document to SearchResult
-    fn doc_to_search_result(&self, doc: &TantivyDocument, score: f32) -> Result<SearchResult> {
+    /// Converts a Tantivy document to SearchResult. When `selected` is
+    /// set, only those stored fields are copied out (doc_id and score
+    /// always are); unselected fields stay empty.
+    fn doc_to_search_result(
+        &self,
+        doc: &TantivyDocument,
+        score: f32,
+        selected: Option<&[String]>,
+    ) -> Result<SearchResult> {
         let schema = &self.schema;
+        let wanted =
+            |name: &str| selected.map_or(true, |fields| fields.iter().any(|f| f == name));
 
+        // Always materialized: the pagination cursor needs it
         let doc_id = doc
             .get_first(schema.get_field(FIELD_DOC_ID)?)
             .and_then(|v| v.as_u64())
             .unwrap_or(0);
 
-        let tool = doc
-            .get_first(schema.get_field(FIELD_TOOL)?)
-            .and_then(|v| v.as_str())
-            .unwrap_or("")
-            .to_string();
-
-        let log_type = doc
-            .get_first(schema.get_field(FIELD_LOG_TYPE)?)
-            .and_then(|v| v.as_str())
-            .unwrap_or("")
-            .to_string();
-
-        let timestamp = doc
-            .get_first(schema.get_field(FIELD_TIMESTAMP)?)
-            .and_then(|v| v.as_datetime())
-            .map(|dt| {
-                // Convert tantivy DateTime to timestamp and then to string
-                let micros = dt.into_timestamp_micros();
-                let secs = micros / 1_000_000;
-                let nanos = ((micros % 1_000_000) * 1000) as u32;
-                chrono::DateTime::from_timestamp(secs, nanos)
-                    .unwrap_or_default()
-                    .to_rfc3339()
-            });
-
-        let level = doc
-            .get_first(schema.get_field(FIELD_LEVEL)?)
-            .and_then(|v| v.as_str())
-            .unwrap_or("")
-            .to_string();
-
-        let category = doc
-            .get_first(schema.get_field(FIELD_CATEGORY)?)
-            .and_then(|v| v.as_str())
-            .unwrap_or("")
-            .to_string();
-
-        let message = doc
-            .get_first(schema.get_field(FIELD_MESSAGE)?)
-            .and_then(|v| v.as_str())
-            .unwrap_or("")
-            .to_string();
-
-        let file_path = doc
-            .get_first(schema.get_field(FIELD_FILE_PATH)?)
-            .and_then(|v| v.as_str())
-            .unwrap_or("")
-            .to_string();
-
-        let project = doc
-            .get_first(schema.get_field(FIELD_PROJECT)?)
-            .and_then(|v| v.as_str())
-            .unwrap_or("")
-            .to_string();
+        let text_field = |name: &str| -> Result<String> {
+            if !wanted(name) {
+                return Ok(String::new());
+            }
+            Ok(doc
+                .get_first(schema.get_field(name)?)
+                .and_then(|v| v.as_str())
+                .unwrap_or("")
+                .to_string())
+        };
+
+        let tool = text_field(FIELD_TOOL)?;
+        let log_type = text_field(FIELD_LOG_TYPE)?;
+
+        let timestamp = if wanted(FIELD_TIMESTAMP) {
+            doc.get_first(schema.get_field(FIELD_TIMESTAMP)?)
+                .and_then(|v| v.as_datetime())
+                .map(|dt| {
+                    // Convert tantivy DateTime to timestamp and then to string
+                    let micros = dt.into_timestamp_micros();
+                    let secs = micros / 1_000_000;
+                    let nanos = ((micros % 1_000_000) * 1000) as u32;
+                    chrono::DateTime::from_timestamp(secs, nanos)
+                        .unwrap_or_default()
+                        .to_rfc3339()
+                })
+        } else {
+            None
+        };
+
+        let level = text_field(FIELD_LEVEL)?;
+        let category = text_field(FIELD_CATEGORY)?;
+        let message = text_field(FIELD_MESSAGE)?;
+        let file_path = text_field(FIELD_FILE_PATH)?;
+        let project = text_field(FIELD_PROJECT)?;
 
         Ok(SearchResult {
             doc_id,
@@ -425,5 +526,57 @@ mod tests {
         assert_eq!(query.limit, 100);
         assert_eq!(query.offset, 0);
         assert!(!query.regex);
+        assert!(query.after.is_none());
+        assert!(query.selected_fields.is_none());
+    }
+
+    #[test]
+    fn test_search_after_pagination() {
+        let dir = std::env::temp_dir().join(format!("vibedev-test-index-{}", std::process::id()));
+        let _ = std::fs::remove_dir_all(&dir);
+        std::fs::create_dir_all(&dir).unwrap();
+
+        let schema = build_schema();
+        let index = Index::create_in_dir(&dir, schema.clone()).unwrap();
+        let mut writer = index.writer(15_000_000).unwrap();
+        for i in 0..10u64 {
+            let entry = LogEntryDocument {
+                doc_id: i,
+                tool: "Claude Code".to_string(),
+                log_type: "History".to_string(),
+                timestamp: None,
+                level: "Info".to_string(),
+                category: "UserPrompt".to_string(),
+                message: "hello world".to_string(),
+                file_path: "/tmp/test.jsonl".to_string(),
+                project: "test".to_string(),
+            };
+            writer
+                .add_document(entry.to_tantivy_document(&schema))
+                .unwrap();
+        }
+        writer.commit().unwrap();
+
+        let executor = QueryExecutor::new(&dir).unwrap();
+        let mut query = SearchQuery {
+            text: "hello".to_string(),
+            limit: 4,
+            ..Default::default()
+        };
+
+        let page1 = executor.execute(&query).unwrap();
+        assert_eq!(page1.results.len(), 4);
+        let cursor = page1.next_cursor.expect("full page yields a cursor");
+
+        query.after = Some(cursor);
+        let page2 = executor.execute(&query).unwrap();
+        assert_eq!(page2.results.len(), 4);
+
+        // Pages must be disjoint: the cursor skips everything already seen
+        let ids1: Vec<u64> = page1.results.iter().map(|r| r.doc_id).collect();
+        let ids2: Vec<u64> = page2.results.iter().map(|r| r.doc_id).collect();
+        assert!(ids1.iter().all(|id| !ids2.contains(id)));
+
+        let _ = std::fs::remove_dir_all(&dir);
     }
 }
@@ -255,6 +255,6 @@ mod tests {
         let tantivy_doc = entry_doc.to_tantivy_document(&schema);
 
         // Verify document was created (basic check)
-        assert!(!tantivy_doc.is_empty());
+        assert!(!tantivy_doc.field_values().is_empty());
     }
 }
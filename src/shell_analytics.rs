@@ -1,7 +1,32 @@
 // Shell Command Analytics - Productivity patterns from terminal usage
+use anyhow::Result;
 use chrono::{DateTime, Utc};
+use md5::{Digest, Md5};
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
+use std::fs;
+use std::io::{Read, Seek, SeekFrom};
+use std::path::Path;
+
+use crate::cache;
+use crate::history_sanitizer::HistorySanitizer;
+
+/// Cache key for the persisted ingest state (offsets + aggregates)
+const STATE_CACHE_KEY: &str = "shell-history-state";
+
+/// How many leading bytes of a history file the rewrite-detection digest
+/// covers. Appends leave the head untouched; a rotated or rewritten file
+/// changes it even when the new file happens to be larger.
+const HEAD_DIGEST_BYTES: u64 = 4096;
+
+/// Shell history files scanned under the home directory
+const HISTORY_FILES: &[(&str, &str)] = &[
+    (".bash_history", "bash"),
+    (".zsh_history", "zsh"),
+    (".zhistory", "zsh"),
+    (".sh_history", "sh"),
+    (".fish/fish_history", "fish"),
+];
 
 #[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct ShellAnalytics {
@@ -63,53 +88,284 @@ pub struct CommandChain {
     pub avg_success_rate: f64,
 }
 
-pub struct ShellAnalyzer {
-    commands: Vec<ParsedCommand>,
+/// Counted error category with a few example commands retained
+#[derive(Debug, Clone, Default, Serialize, Deserialize)]
+struct ErrorBucket {
+    count: usize,
+    examples: Vec<String>,
 }
 
-#[derive(Debug, Clone)]
-struct ParsedCommand {
+impl ErrorBucket {
+    fn record(&mut self, command: &str) {
+        self.count += 1;
+        if self.examples.len() < 3 {
+            self.examples.push(command.to_string());
+        }
+    }
+}
+
+/// A command held while a potential struggle run is still open
+#[derive(Debug, Clone, Serialize, Deserialize)]
+struct PendingCommand {
     text: String,
     timestamp: Option<DateTime<Utc>>,
-    base_command: String, // First word (e.g., "git" from "git commit")
-    is_likely_error: bool,
+}
+
+/// Streaming aggregator over shell history lines. All state is mergeable
+/// across ingest chunks (the open struggle run and the previous base
+/// command carry over), and the whole analyzer serializes, so it can be
+/// persisted and resumed from the appended tail of a history file instead
+/// of re-tokenizing millions of unchanged lines on every run.
+#[derive(Debug, Clone, Default, Serialize, Deserialize)]
+pub struct ShellAnalyzer {
+    total_commands: usize,
+    total_command_length: u64,
+    command_counts: HashMap<String, usize>,
+    estimated_failures: usize,
+    commands_by_hour: HashMap<u32, usize>,
+
+    // Error categories
+    npm_errors: ErrorBucket,
+    cargo_errors: ErrorBucket,
+    git_errors: ErrorBucket,
+    permission_errors: ErrorBucket,
+
+    // Sequence-derived state
+    chain_counts: HashMap<Vec<String>, usize>,
+    struggle_sessions: Vec<StruggleSession>,
+
+    // Carry-over across ingest chunks
+    pending_struggle: Vec<PendingCommand>,
+    prev_base_command: Option<String>,
+}
+
+/// Where ingestion stopped in one history file, plus a digest of the file
+/// head so rotation/rewrite is detected even when the file grew
+#[derive(Debug, Clone, Serialize, Deserialize)]
+struct FileIngestMark {
+    offset: u64,
+    head_digest: String,
+}
+
+/// Persisted ingest state: per-file offsets and the accumulated analyzer
+#[derive(Debug, Default, Serialize, Deserialize)]
+struct ShellIngestState {
+    files: HashMap<String, FileIngestMark>,
+    analyzer: ShellAnalyzer,
 }
 
 impl ShellAnalyzer {
     pub fn new() -> Self {
-        Self {
-            commands: Vec::new(),
-        }
+        Self::default()
     }
 
-    /// Load commands from shell history
-    pub fn load_history(&mut self, history_content: &str, shell_type: &str) {
-        for line in history_content.lines() {
-            if line.trim().is_empty() {
+    /// Incremental entry point: restores the persisted ingest state,
+    /// sanitizes and ingests only the bytes appended to each history file
+    /// since the recorded offset, persists the updated state, and returns
+    /// the analytics. A truncated or rewritten file invalidates the whole
+    /// state (aggregates from all files are merged) and triggers a full
+    /// re-ingest.
+    pub fn analyze_incremental(home_dir: &Path) -> Result<ShellAnalytics> {
+        let mut state: ShellIngestState =
+            cache::cache_load_bin(STATE_CACHE_KEY).ok().flatten().unwrap_or_default();
+
+        if !Self::marks_still_valid(&state, home_dir) {
+            state = ShellIngestState::default();
+        }
+
+        let sanitizer = HistorySanitizer::new();
+        for (file, shell_type) in HISTORY_FILES {
+            let path = home_dir.join(file);
+            if !path.exists() {
                 continue;
             }
+            let key = path.to_string_lossy().to_string();
+            let offset = state.files.get(&key).map(|m| m.offset).unwrap_or(0);
+
+            let (chunk, consumed) = match Self::read_appended(&path, offset) {
+                Ok(appended) => appended,
+                Err(e) => {
+                    eprintln!("Warning: Could not read {}: {}", file, e);
+                    continue;
+                }
+            };
+
+            for line in chunk.lines() {
+                let line = sanitizer.sanitize_line(line);
+                state.analyzer.ingest_line(&line, shell_type);
+            }
 
-            let (timestamp, command_text) = self.parse_history_line(line, shell_type);
+            let new_offset = offset + consumed;
+            let head_digest = Self::head_digest(&path, new_offset)?;
+            state.files.insert(
+                key,
+                FileIngestMark {
+                    offset: new_offset,
+                    head_digest,
+                },
+            );
+        }
+
+        let analytics = state.analyzer.analyze();
 
-            if command_text.is_empty() {
+        // Best-effort: a failed save just means the next run re-ingests
+        if let Err(e) = cache::cache_save_bin(STATE_CACHE_KEY, &state) {
+            eprintln!("Warning: Could not persist shell ingest state: {}", e);
+        }
+
+        Ok(analytics)
+    }
+
+    /// True when every tracked file still looks append-only: at least as
+    /// large as the recorded offset, with an unchanged head digest
+    fn marks_still_valid(state: &ShellIngestState, home_dir: &Path) -> bool {
+        for (file, _) in HISTORY_FILES {
+            let path = home_dir.join(file);
+            let key = path.to_string_lossy().to_string();
+            let Some(mark) = state.files.get(&key) else {
                 continue;
+            };
+
+            let grown_in_place = fs::metadata(&path)
+                .map(|meta| meta.len() >= mark.offset)
+                .unwrap_or(false);
+            let head_matches = Self::head_digest(&path, mark.offset)
+                .map(|digest| digest == mark.head_digest)
+                .unwrap_or(false);
+
+            if !grown_in_place || !head_matches {
+                return false;
             }
+        }
+        true
+    }
+
+    /// Read everything after `offset`, cut at the last complete line so a
+    /// write-in-progress tail is left for the next run. Returns the text
+    /// and the number of bytes consumed.
+    fn read_appended(path: &Path, offset: u64) -> Result<(String, u64)> {
+        let mut file = fs::File::open(path)?;
+        file.seek(SeekFrom::Start(offset))?;
+        let mut bytes = Vec::new();
+        file.read_to_end(&mut bytes)?;
+
+        let cut = bytes
+            .iter()
+            .rposition(|&b| b == b'\n')
+            .map(|i| i + 1)
+            .unwrap_or(0);
+        let text = String::from_utf8_lossy(&bytes[..cut]).into_owned();
+
+        Ok((text, cut as u64))
+    }
+
+    /// Digest of the first `min(upto, HEAD_DIGEST_BYTES)` bytes of a file
+    fn head_digest(path: &Path, upto: u64) -> Result<String> {
+        let mut file = fs::File::open(path)?;
+        let mut head = vec![0u8; upto.min(HEAD_DIGEST_BYTES) as usize];
+        file.read_exact(&mut head)?;
+        Ok(format!("{:x}", Md5::digest(&head)))
+    }
+
+    /// Load commands from shell history content in one go
+    pub fn load_history(&mut self, history_content: &str, shell_type: &str) {
+        for line in history_content.lines() {
+            self.ingest_line(line, shell_type);
+        }
+    }
+
+    /// Feed one history line into the running aggregates
+    pub fn ingest_line(&mut self, line: &str, shell_type: &str) {
+        if line.trim().is_empty() {
+            return;
+        }
+
+        let (timestamp, command_text) = self.parse_history_line(line, shell_type);
+
+        if command_text.is_empty() {
+            return;
+        }
+
+        let base_command = command_text
+            .split_whitespace()
+            .next()
+            .unwrap_or("")
+            .to_string();
 
-            let base_command = command_text
-                .split_whitespace()
-                .next()
-                .unwrap_or("")
-                .to_string();
+        let is_error = self.is_likely_error(&command_text);
 
-            let is_error = self.is_likely_error(&command_text);
+        self.total_commands += 1;
+        self.total_command_length += command_text.len() as u64;
+        *self.command_counts.entry(base_command.clone()).or_insert(0) += 1;
+        if is_error {
+            self.estimated_failures += 1;
+        }
+        if let Some(ts) = timestamp {
+            use chrono::Timelike;
+            *self.commands_by_hour.entry(ts.hour()).or_insert(0) += 1;
+        }
 
-            self.commands.push(ParsedCommand {
-                text: command_text.to_string(),
+        // Error categories
+        if command_text.contains("npm")
+            && (command_text.contains("ERR") || command_text.contains("error"))
+        {
+            self.npm_errors.record(&command_text);
+        } else if command_text.contains("cargo") && is_error {
+            self.cargo_errors.record(&command_text);
+        } else if command_text.contains("git") && is_error {
+            self.git_errors.record(&command_text);
+        } else if command_text.to_lowercase().contains("permission denied") {
+            self.permission_errors.record(&command_text);
+        }
+
+        // Command chains (2-command sequences); prev_base_command carries
+        // across ingest chunks so chunk boundaries do not lose a bigram
+        if let Some(prev) = self.prev_base_command.take() {
+            *self
+                .chain_counts
+                .entry(vec![prev, base_command.clone()])
+                .or_insert(0) += 1;
+        }
+        self.prev_base_command = Some(base_command.clone());
+
+        // Struggle detection: an open run stays pending until a
+        // non-struggle command closes it (or, across runs, until a later
+        // ingest appends one)
+        let is_struggle_command = is_error
+            || base_command == "npm"
+            || base_command == "cargo"
+            || base_command == "git";
+
+        if is_struggle_command {
+            self.pending_struggle.push(PendingCommand {
+                text: command_text,
                 timestamp,
-                base_command,
-                is_likely_error: is_error,
+            });
+        } else {
+            self.close_struggle_run();
+        }
+    }
+
+    /// Close the open struggle run, emitting a session if it was long
+    /// enough to count as one (3+ related commands)
+    fn close_struggle_run(&mut self) {
+        if self.pending_struggle.len() >= 3 {
+            let struggle_type = self.classify_struggle(&self.pending_struggle);
+
+            self.struggle_sessions.push(StruggleSession {
+                timestamp: self
+                    .pending_struggle
+                    .first()
+                    .and_then(|c| c.timestamp)
+                    .unwrap_or_else(Utc::now),
+                commands: self.pending_struggle.iter().map(|c| c.text.clone()).collect(),
+                retries: self.pending_struggle.len(),
+                duration_minutes: self.pending_struggle.len() as f64 * 2.0, // Estimate
+                eventually_succeeded: true, // A later command closed the run
+                struggle_type,
             });
         }
+        self.pending_struggle.clear();
     }
 
     fn parse_history_line(&self, line: &str, shell_type: &str) -> (Option<DateTime<Utc>>, String) {
@@ -162,34 +418,34 @@ impl ShellAnalyzer {
     }
 
     pub fn analyze(&self) -> ShellAnalytics {
-        let total_commands = self.commands.len();
-        let unique_commands = self.count_unique_commands();
+        let total_commands = self.total_commands;
+        let unique_commands = self.command_counts.len();
         let most_used = self.find_most_used_commands(20);
 
         // Error analysis
-        let estimated_failures = self.commands.iter().filter(|c| c.is_likely_error).count();
+        let estimated_failures = self.estimated_failures;
         let failure_rate = if total_commands > 0 {
             estimated_failures as f64 / total_commands as f64 * 100.0
         } else {
             0.0
         };
 
-        let common_errors = self.analyze_error_patterns();
+        let common_errors = self.collect_error_patterns();
         let time_wasted = self.estimate_time_wasted(&common_errors);
 
-        // Workflow patterns
-        let struggle_sessions = self.detect_struggle_sessions();
+        // Workflow patterns. A run still pending at the end of the history
+        // is not emitted: its closing command has not been seen yet.
+        let struggle_sessions = self.struggle_sessions.clone();
         let command_chains = self.find_common_chains();
 
-        let avg_length: f64 = if !self.commands.is_empty() {
-            self.commands.iter().map(|c| c.text.len()).sum::<usize>() as f64
-                / self.commands.len() as f64
+        let avg_length: f64 = if total_commands > 0 {
+            self.total_command_length as f64 / total_commands as f64
         } else {
             0.0
         };
 
         // Time patterns
-        let commands_by_hour = self.commands_by_hour_of_day();
+        let commands_by_hour = self.commands_by_hour.clone();
         let most_active_hour = commands_by_hour
             .iter()
             .max_by_key(|(_, count)| **count)
@@ -217,86 +473,37 @@ impl ShellAnalyzer {
         }
     }
 
-    fn count_unique_commands(&self) -> usize {
-        let mut unique = std::collections::HashSet::new();
-        for cmd in &self.commands {
-            unique.insert(&cmd.base_command);
-        }
-        unique.len()
-    }
-
     fn find_most_used_commands(&self, limit: usize) -> Vec<(String, usize)> {
-        let mut counts: HashMap<String, usize> = HashMap::new();
-        for cmd in &self.commands {
-            *counts.entry(cmd.base_command.clone()).or_insert(0) += 1;
-        }
-
-        let mut sorted: Vec<_> = counts.into_iter().collect();
+        let mut sorted: Vec<_> = self
+            .command_counts
+            .iter()
+            .map(|(cmd, count)| (cmd.clone(), *count))
+            .collect();
         sorted.sort_by(|a, b| b.1.cmp(&a.1));
         sorted.truncate(limit);
         sorted
     }
 
-    fn analyze_error_patterns(&self) -> Vec<ErrorPattern> {
+    fn collect_error_patterns(&self) -> Vec<ErrorPattern> {
         let mut patterns = Vec::new();
 
-        // Group by error type
-        let mut npm_errors = Vec::new();
-        let mut cargo_errors = Vec::new();
-        let mut git_errors = Vec::new();
-        let mut permission_errors = Vec::new();
-
-        for cmd in &self.commands {
-            if cmd.text.contains("npm") && (cmd.text.contains("ERR") || cmd.text.contains("error"))
-            {
-                npm_errors.push(cmd.text.clone());
-            } else if cmd.text.contains("cargo") && cmd.is_likely_error {
-                cargo_errors.push(cmd.text.clone());
-            } else if cmd.text.contains("git") && cmd.is_likely_error {
-                git_errors.push(cmd.text.clone());
-            } else if cmd.text.to_lowercase().contains("permission denied") {
-                permission_errors.push(cmd.text.clone());
-            }
-        }
-
-        if !npm_errors.is_empty() {
-            patterns.push(ErrorPattern {
-                error_type: "NPM Errors".to_string(),
-                count: npm_errors.len(),
-                example_commands: npm_errors.iter().take(3).cloned().collect(),
-                avg_retries: 2.8,
-                estimated_time_wasted_minutes: npm_errors.len() as f64 * 5.0,
-            });
-        }
-
-        if !cargo_errors.is_empty() {
-            patterns.push(ErrorPattern {
-                error_type: "Cargo Build/Test Failures".to_string(),
-                count: cargo_errors.len(),
-                example_commands: cargo_errors.iter().take(3).cloned().collect(),
-                avg_retries: 3.2,
-                estimated_time_wasted_minutes: cargo_errors.len() as f64 * 8.0,
-            });
-        }
-
-        if !git_errors.is_empty() {
-            patterns.push(ErrorPattern {
-                error_type: "Git Errors".to_string(),
-                count: git_errors.len(),
-                example_commands: git_errors.iter().take(3).cloned().collect(),
-                avg_retries: 2.1,
-                estimated_time_wasted_minutes: git_errors.len() as f64 * 3.0,
-            });
-        }
+        let buckets = [
+            ("NPM Errors", &self.npm_errors, 2.8, 5.0),
+            ("Cargo Build/Test Failures", &self.cargo_errors, 3.2, 8.0),
+            ("Git Errors", &self.git_errors, 2.1, 3.0),
+            ("Permission Denied", &self.permission_errors, 1.5, 2.0),
+        ];
 
-        if !permission_errors.is_empty() {
-            patterns.push(ErrorPattern {
-                error_type: "Permission Denied".to_string(),
-                count: permission_errors.len(),
-                example_commands: permission_errors.iter().take(3).cloned().collect(),
-                avg_retries: 1.5,
-                estimated_time_wasted_minutes: permission_errors.len() as f64 * 2.0,
-            });
+        for (error_type, bucket, avg_retries, minutes_each) in buckets {
+            if bucket.count > 0 {
+                patterns.push(ErrorPattern {
+                    error_type: error_type.to_string(),
+                    count: bucket.count,
+                    example_commands: bucket.examples.clone(),
+                    avg_retries,
+                    estimated_time_wasted_minutes: bucket.count as f64 * minutes_each,
+                });
+            }
         }
 
         patterns.sort_by(|a, b| b.count.cmp(&a.count));
@@ -311,45 +518,7 @@ impl ShellAnalyzer {
             / 60.0 // Convert to hours
     }
 
-    fn detect_struggle_sessions(&self) -> Vec<StruggleSession> {
-        let mut sessions = Vec::new();
-        let mut current_struggle: Vec<&ParsedCommand> = Vec::new();
-
-        for (i, cmd) in self.commands.iter().enumerate() {
-            // Check if this looks like part of a struggle
-            let is_struggle_command = cmd.is_likely_error
-                || cmd.base_command == "npm"
-                || cmd.base_command == "cargo"
-                || cmd.base_command == "git";
-
-            if is_struggle_command {
-                current_struggle.push(cmd);
-            } else {
-                // End of struggle session
-                if current_struggle.len() >= 3 {
-                    // This was a struggle (3+ related commands)
-                    let struggle_type = self.classify_struggle(&current_struggle);
-
-                    sessions.push(StruggleSession {
-                        timestamp: current_struggle
-                            .first()
-                            .and_then(|c| c.timestamp)
-                            .unwrap_or_else(Utc::now),
-                        commands: current_struggle.iter().map(|c| c.text.clone()).collect(),
-                        retries: current_struggle.len(),
-                        duration_minutes: current_struggle.len() as f64 * 2.0, // Estimate
-                        eventually_succeeded: i < self.commands.len() - 1,     // Heuristic
-                        struggle_type,
-                    });
-                }
-                current_struggle.clear();
-            }
-        }
-
-        sessions
-    }
-
-    fn classify_struggle(&self, commands: &[&ParsedCommand]) -> StruggleType {
+    fn classify_struggle(&self, commands: &[PendingCommand]) -> StruggleType {
         let text = commands
             .iter()
             .map(|c| c.text.as_str())
@@ -372,20 +541,13 @@ impl ShellAnalyzer {
     }
 
     fn find_common_chains(&self) -> Vec<CommandChain> {
-        // Find common 2-3 command sequences
-        let mut chains: HashMap<Vec<String>, usize> = HashMap::new();
-
-        for window in self.commands.windows(2) {
-            let pattern: Vec<String> = window.iter().map(|c| c.base_command.clone()).collect();
-            *chains.entry(pattern).or_insert(0) += 1;
-        }
-
-        let mut result: Vec<_> = chains
-            .into_iter()
-            .filter(|(_, count)| *count >= 3) // At least 3 occurrences
+        let mut result: Vec<_> = self
+            .chain_counts
+            .iter()
+            .filter(|(_, count)| **count >= 3) // At least 3 occurrences
             .map(|(pattern, frequency)| CommandChain {
-                pattern,
-                frequency,
+                pattern: pattern.clone(),
+                frequency: *frequency,
                 avg_success_rate: 0.75, // Estimate
             })
             .collect();
@@ -395,20 +557,6 @@ impl ShellAnalyzer {
         result
     }
 
-    fn commands_by_hour_of_day(&self) -> HashMap<u32, usize> {
-        let mut by_hour: HashMap<u32, usize> = HashMap::new();
-
-        for cmd in &self.commands {
-            if let Some(ts) = cmd.timestamp {
-                use chrono::Timelike;
-                let hour = ts.hour();
-                *by_hour.entry(hour).or_insert(0) += 1;
-            }
-        }
-
-        by_hour
-    }
-
     fn calculate_productivity_score(&self, failure_rate: f64, struggle_count: usize) -> f64 {
         // Score from 0-100
         let base_score = 100.0;
@@ -423,8 +571,35 @@ impl ShellAnalyzer {
     }
 }
 
-impl Default for ShellAnalyzer {
-    fn default() -> Self {
-        Self::new()
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_chunked_ingest_matches_single_pass() {
+        let history = "cargo build\n\
+                       cargo build\n\
+                       cargo test\n\
+                       git commit -m fix\n\
+                       ls\n\
+                       git push\n\
+                       cargo build\n";
+
+        let mut whole = ShellAnalyzer::new();
+        whole.load_history(history, "bash");
+
+        // Split mid-struggle-run so the carry-over state is exercised
+        let mut chunked = ShellAnalyzer::new();
+        let (head, tail) = history.split_at(history.find("git commit").unwrap());
+        chunked.load_history(head, "bash");
+        chunked.load_history(tail, "bash");
+
+        let a = whole.analyze();
+        let b = chunked.analyze();
+        assert_eq!(a.total_commands, b.total_commands);
+        assert_eq!(a.unique_commands, b.unique_commands);
+        assert_eq!(a.estimated_failures, b.estimated_failures);
+        assert_eq!(a.struggle_sessions.len(), b.struggle_sessions.len());
+        assert_eq!(a.command_chains.len(), b.command_chains.len());
     }
 }
@@ -0,0 +1,231 @@
+// Real-time incremental stats engine for the `stats` command and the TUI.
+//
+// Instead of re-running a full discovery scan (and a full conversation
+// parse) on every refresh tick, the engine scans once at startup to seed
+// its counters, then subscribes to filesystem notifications
+// (inotify/FSEvents via the notify crate) over the discovered log
+// locations. Appended JSONL bytes are tailed from the last known offset
+// and folded into the counters, so idle cost is near zero and updates
+// land well under a second after the log write.
+
+use crate::analyzer::ConversationAnalyzer;
+use crate::discovery::LogDiscovery;
+use crate::models::AiTool;
+use anyhow::Result;
+use notify::{Event, EventKind, RecommendedWatcher, RecursiveMode, Watcher};
+use std::collections::HashMap;
+use std::fs::File;
+use std::io::{Read, Seek, SeekFrom};
+use std::path::{Path, PathBuf};
+use std::sync::mpsc;
+use std::sync::{Arc, RwLock};
+use std::thread;
+use walkdir::WalkDir;
+
+/// Cap on how much appended data one event will tail, to bound memory
+/// when a tool dumps a huge file in one write
+const TAIL_READ_MAX: u64 = 4 * 1024 * 1024;
+
+/// Aggregated counters kept current by the notification thread
+#[derive(Debug, Clone, Default)]
+pub struct LiveStats {
+    pub total_size_bytes: u64,
+    pub total_files: usize,
+    pub tool_sizes: HashMap<String, u64>,
+    pub total_conversations: usize,
+    pub total_messages: usize,
+    pub estimated_tokens: u64,
+    /// Number of filesystem events folded in since startup
+    pub updates_applied: u64,
+}
+
+/// Last known state of one tracked file, for computing append deltas
+struct FileState {
+    size: u64,
+    tool: String,
+}
+
+struct EngineState {
+    stats: LiveStats,
+    files: HashMap<PathBuf, FileState>,
+}
+
+pub struct StatsEngine {
+    state: Arc<RwLock<EngineState>>,
+    // Dropping the watcher unsubscribes, so it lives as long as the engine
+    _watcher: RecommendedWatcher,
+}
+
+impl StatsEngine {
+    /// Seeds the counters with one full scan, then starts watching the
+    /// discovered log locations for changes
+    pub fn new(base_dir: PathBuf, include_hidden: bool) -> Result<Self> {
+        let discovery = LogDiscovery::new(base_dir.clone(), include_hidden);
+        let findings = discovery.scan()?;
+
+        let mut stats = LiveStats::default();
+        let mut files = HashMap::new();
+
+        // Record per-file sizes so later events can be applied as deltas
+        for location in &findings.locations {
+            let tool = location.tool.name().to_string();
+            for entry in WalkDir::new(&location.path)
+                .into_iter()
+                .filter_map(|e| e.ok())
+            {
+                if !entry.file_type().is_file() {
+                    continue;
+                }
+                let Ok(meta) = entry.metadata() else { continue };
+
+                let size = meta.len();
+                stats.total_size_bytes += size;
+                stats.total_files += 1;
+                *stats.tool_sizes.entry(tool.clone()).or_insert(0) += size;
+                files.insert(
+                    entry.path().to_path_buf(),
+                    FileState {
+                        size,
+                        tool: tool.clone(),
+                    },
+                );
+            }
+        }
+
+        // Seed conversation counters once; events only add deltas on top
+        if let Ok(conv_stats) = ConversationAnalyzer::new(base_dir.clone()).analyze() {
+            stats.total_conversations = conv_stats.total_conversations;
+            stats.total_messages = conv_stats.total_messages;
+            stats.estimated_tokens = conv_stats.total_tokens_estimate;
+        }
+        if stats.estimated_tokens == 0 {
+            stats.estimated_tokens = stats.total_size_bytes / 4;
+        }
+
+        let state = Arc::new(RwLock::new(EngineState { stats, files }));
+
+        // Subscribe to filesystem notifications over every discovered
+        // location; events are applied on a dedicated thread
+        let (tx, rx) = mpsc::channel();
+        let mut watcher = notify::recommended_watcher(move |res| {
+            let _ = tx.send(res);
+        })?;
+
+        for location in &findings.locations {
+            // Locations can disappear between scan and watch; skip quietly
+            let _ = watcher.watch(&location.path, RecursiveMode::Recursive);
+        }
+
+        let thread_state = Arc::clone(&state);
+        thread::spawn(move || {
+            for event in rx.into_iter().flatten() {
+                apply_event(&thread_state, &event);
+            }
+        });
+
+        Ok(Self {
+            state,
+            _watcher: watcher,
+        })
+    }
+
+    /// Current counters; cheap enough to call every render tick
+    pub fn snapshot(&self) -> LiveStats {
+        self.state
+            .read()
+            .map(|s| s.stats.clone())
+            .unwrap_or_default()
+    }
+}
+
+/// Folds one filesystem event into the counters
+fn apply_event(state: &Arc<RwLock<EngineState>>, event: &Event) {
+    match event.kind {
+        EventKind::Create(_) | EventKind::Modify(_) | EventKind::Remove(_) => {}
+        _ => return,
+    }
+
+    let Ok(mut state) = state.write() else { return };
+    let state = &mut *state;
+
+    for path in &event.paths {
+        match std::fs::metadata(path) {
+            Ok(meta) if meta.is_file() => {
+                let new_size = meta.len();
+                let (old_size, tool) = match state.files.get(path) {
+                    Some(existing) => (existing.size, existing.tool.clone()),
+                    None => {
+                        // Newly created file
+                        let tool = AiTool::from_path(path)
+                            .map(|t| t.name().to_string())
+                            .unwrap_or_else(|| "Unknown".to_string());
+                        state.stats.total_files += 1;
+                        (0, tool)
+                    }
+                };
+
+                if new_size == old_size {
+                    continue;
+                }
+
+                state.stats.total_size_bytes = state
+                    .stats
+                    .total_size_bytes
+                    .wrapping_add(new_size)
+                    .wrapping_sub(old_size);
+                let tool_size = state.stats.tool_sizes.entry(tool.clone()).or_insert(0);
+                *tool_size = tool_size.wrapping_add(new_size).wrapping_sub(old_size);
+
+                // Appended JSONL bytes carry new log entries: tail them
+                // from the old offset instead of re-reading the file
+                if new_size > old_size && path.extension().is_some_and(|ext| ext == "jsonl") {
+                    tail_appended_lines(path, old_size, new_size, &mut state.stats);
+                }
+
+                state
+                    .files
+                    .insert(path.clone(), FileState { size: new_size, tool });
+                state.stats.updates_applied += 1;
+            }
+            _ => {
+                // Removed (or unreadable): drop its contribution
+                if let Some(removed) = state.files.remove(path) {
+                    state.stats.total_size_bytes =
+                        state.stats.total_size_bytes.saturating_sub(removed.size);
+                    state.stats.total_files = state.stats.total_files.saturating_sub(1);
+                    if let Some(tool_size) = state.stats.tool_sizes.get_mut(&removed.tool) {
+                        *tool_size = tool_size.saturating_sub(removed.size);
+                    }
+                    state.stats.updates_applied += 1;
+                }
+            }
+        }
+    }
+}
+
+/// Reads only the appended region of a JSONL file and counts the new
+/// entries, using the same 1 token ≈ 4 chars estimate as the parsers
+fn tail_appended_lines(path: &Path, old_size: u64, new_size: u64, stats: &mut LiveStats) {
+    let appended = new_size - old_size;
+    stats.estimated_tokens += appended / 4;
+
+    let Ok(mut file) = File::open(path) else { return };
+    if file.seek(SeekFrom::Start(old_size)).is_err() {
+        return;
+    }
+
+    let mut buf = String::new();
+    let read = file
+        .take(appended.min(TAIL_READ_MAX))
+        .read_to_string(&mut buf);
+    if read.is_err() {
+        return;
+    }
+
+    for line in buf.lines() {
+        if line.trim().is_empty() {
+            continue;
+        }
+        stats.total_messages += 1;
+    }
+}
@@ -3,6 +3,7 @@ use std::collections::{HashMap, HashSet};
 use std::fs::{self, File};
 use std::io::Write;
 use std::path::{Path, PathBuf};
+use rayon::prelude::*;
 use regex::Regex;
 
 use crate::sourcemap_unbundler::{SourceMap, SourceMapExtractor};
@@ -118,57 +119,79 @@ impl StructureRecovery {
         println!("  [+] Identified {} code modules", modules.len());
 
         // Match modules to file paths using heuristics
-        let assignments = self.match_modules_to_files(&modules, file_paths)?;
+        let assignments: Vec<(String, String)> = self
+            .match_modules_to_files(&modules, file_paths)?
+            .into_iter()
+            .collect();
+
+        // Once assignments are fixed each recovered module is independent,
+        // so deobfuscation (the expensive part) and the output writes fan
+        // out across the thread pool, one file per worker
+        let outcomes = assignments
+            .into_par_iter()
+            .map(|(file_path, module_code)| -> std::io::Result<ModuleOutcome> {
+                // Detect if this is node_modules code
+                let is_dependency = self.is_node_module(&file_path, &module_code);
+
+                // Extract dependency names
+                let dependency_name = if is_dependency {
+                    self.extract_dependency_name(&file_path, &module_code)
+                } else {
+                    None
+                };
 
-        // Write code to files, separating node_modules
-        let mut node_modules_count = 0;
-        let mut app_code_count = 0;
-        let mut ai_generated_names = 0;
-        let mut detected_dependencies: HashSet<String> = HashSet::new();
+                let sanitized = self.sanitize_path(&file_path);
 
-        for (file_path, module_code) in assignments {
-            // Detect if this is node_modules code
-            let is_dependency = self.is_node_module(&file_path, &module_code);
+                // Place node_modules code in separate directory
+                let full_path = if is_dependency {
+                    output_dir.join("node_modules").join(&sanitized)
+                } else {
+                    output_dir.join(&sanitized)
+                };
 
-            // Extract dependency names
-            if is_dependency {
-                if let Some(dep_name) = self.extract_dependency_name(&file_path, &module_code) {
-                    detected_dependencies.insert(dep_name);
+                // Ensure parent directory exists
+                if let Some(parent) = full_path.parent() {
+                    fs::create_dir_all(parent)?;
                 }
-            }
 
-            let sanitized = self.sanitize_path(&file_path);
+                // Optionally deobfuscate the code (skip for node_modules to save time)
+                let final_code = if self.deobfuscate && !is_dependency {
+                    let mut deobfuscator = JSDeobfuscator::new(module_code.clone())
+                        .with_verbosity(false);
+                    deobfuscator.deobfuscate()
+                } else {
+                    module_code
+                };
 
-            // Track AI-generated filenames
-            if file_path.ends_with(".AI") {
-                ai_generated_names += 1;
-            }
+                let mut file = File::create(&full_path)?;
+                file.write_all(final_code.as_bytes())?;
+
+                Ok(ModuleOutcome {
+                    is_dependency,
+                    is_ai_named: file_path.ends_with(".AI"),
+                    dependency_name,
+                })
+            })
+            .collect::<std::io::Result<Vec<ModuleOutcome>>>()?;
+
+        // Aggregate per-module outcomes back on the calling thread
+        let mut node_modules_count = 0;
+        let mut app_code_count = 0;
+        let mut ai_generated_names = 0;
+        let mut detected_dependencies: HashSet<String> = HashSet::new();
 
-            // Place node_modules code in separate directory
-            let full_path = if is_dependency {
+        for outcome in outcomes {
+            if outcome.is_dependency {
                 node_modules_count += 1;
-                output_dir.join("node_modules").join(&sanitized)
             } else {
                 app_code_count += 1;
-                output_dir.join(&sanitized)
-            };
-
-            // Ensure parent directory exists
-            if let Some(parent) = full_path.parent() {
-                fs::create_dir_all(parent)?;
             }
-
-            // Optionally deobfuscate the code (skip for node_modules to save time)
-            let final_code = if self.deobfuscate && !is_dependency {
-                let mut deobfuscator = JSDeobfuscator::new(module_code.clone())
-                    .with_verbosity(false);
-                deobfuscator.deobfuscate()
-            } else {
-                module_code
-            };
-
-            let mut file = File::create(&full_path)?;
-            file.write_all(final_code.as_bytes())?;
+            if outcome.is_ai_named {
+                ai_generated_names += 1;
+            }
+            if let Some(dep_name) = outcome.dependency_name {
+                detected_dependencies.insert(dep_name);
+            }
         }
 
         println!("  [+] Application code files: {}", app_code_count);
@@ -852,6 +875,13 @@ These require **manual review** to:
     }
 }
 
+/// What a parallel per-module write reports back for aggregation
+struct ModuleOutcome {
+    is_dependency: bool,
+    is_ai_named: bool,
+    dependency_name: Option<String>,
+}
+
 #[derive(Debug, Clone)]
 struct CodeModule {
     name: String,
@@ -4,7 +4,7 @@ use chrono::{DateTime, Duration, Utc};
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
 use std::fs;
-use std::path::PathBuf;
+use std::path::{Path, PathBuf};
 
 #[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct WorkSession {
@@ -1424,65 +1424,77 @@ impl TimelineAnalyzer {
     // ========== GIT COMMITS - THE BIG ONE! ==========
 
     fn parse_git_commits(&self) -> Result<Vec<WorkSession>> {
-        use std::process::Command;
-
-        let mut sessions = Vec::new();
+        use rayon::prelude::*;
 
         // Find all git repos recursively
         let git_repos = self.find_git_repos()?;
 
-        for repo_path in git_repos {
-            // Get git log with timestamps
-            let output = Command::new("git")
-                .arg("-C")
-                .arg(&repo_path)
-                .arg("log")
-                .arg("--all")
-                .arg("--pretty=format:%H|%an|%ae|%at|%s")
-                .arg("--no-merges") // Skip merge commits
-                .output();
-
-            if let Ok(output) = output {
-                if output.status.success() {
-                    let log_text = String::from_utf8_lossy(&output.stdout);
-
-                    for line in log_text.lines() {
-                        let parts: Vec<&str> = line.split('|').collect();
-                        if parts.len() >= 5 {
-                            let _commit_hash = parts[0];
-                            let _author = parts[1];
-                            let timestamp = parts[3].parse::<i64>().unwrap_or(0);
-                            let message = parts[4];
-
-                            let commit_time =
-                                DateTime::from_timestamp(timestamp, 0).unwrap_or(Utc::now());
-                            let _end_time = commit_time + Duration::minutes(30); // Estimate 30min per commit
-
-                            let repo_name = repo_path
-                                .file_name()
-                                .and_then(|n| n.to_str())
-                                .unwrap_or("unknown-repo")
-                                .to_string();
+        // Each repo is a single `git log` invocation; fan them out across
+        // the thread pool since a workspace can hold dozens of repos and
+        // the calls are independent.
+        let sessions = git_repos
+            .par_iter()
+            .flat_map_iter(|repo_path| Self::parse_repo_commits(repo_path))
+            .collect();
 
-                            sessions.push(WorkSession {
-                                id: format!("git-{}-{}", repo_name, timestamp),
-                                start: commit_time - Duration::minutes(30),
-                                end: commit_time,
-                                project: format!("Git: {}", repo_name),
-                                description: message.to_string(),
-                                conversations: 0,
-                                messages: 1,                        // 1 commit
-                                outcome: SessionOutcome::Completed, // Commits are completed work!
-                                resumed_from: None,
-                                hours: 0.5,
-                            });
-                        }
+        Ok(sessions)
+    }
+
+    fn parse_repo_commits(repo_path: &Path) -> Vec<WorkSession> {
+        use std::process::Command;
+
+        let mut sessions = Vec::new();
+
+        // Get git log with timestamps
+        let output = Command::new("git")
+            .arg("-C")
+            .arg(repo_path)
+            .arg("log")
+            .arg("--all")
+            .arg("--pretty=format:%H|%an|%ae|%at|%s")
+            .arg("--no-merges") // Skip merge commits
+            .output();
+
+        if let Ok(output) = output {
+            if output.status.success() {
+                let log_text = String::from_utf8_lossy(&output.stdout);
+
+                for line in log_text.lines() {
+                    let parts: Vec<&str> = line.split('|').collect();
+                    if parts.len() >= 5 {
+                        let _commit_hash = parts[0];
+                        let _author = parts[1];
+                        let timestamp = parts[3].parse::<i64>().unwrap_or(0);
+                        let message = parts[4];
+
+                        let commit_time =
+                            DateTime::from_timestamp(timestamp, 0).unwrap_or(Utc::now());
+                        let _end_time = commit_time + Duration::minutes(30); // Estimate 30min per commit
+
+                        let repo_name = repo_path
+                            .file_name()
+                            .and_then(|n| n.to_str())
+                            .unwrap_or("unknown-repo")
+                            .to_string();
+
+                        sessions.push(WorkSession {
+                            id: format!("git-{}-{}", repo_name, timestamp),
+                            start: commit_time - Duration::minutes(30),
+                            end: commit_time,
+                            project: format!("Git: {}", repo_name),
+                            description: message.to_string(),
+                            conversations: 0,
+                            messages: 1,                        // 1 commit
+                            outcome: SessionOutcome::Completed, // Commits are completed work!
+                            resumed_from: None,
+                            hours: 0.5,
+                        });
                     }
                 }
             }
         }
 
-        Ok(sessions)
+        sessions
     }
 
     pub fn find_git_repos(&self) -> Result<Vec<PathBuf>> {
@@ -6,9 +6,12 @@ use chrono::{DateTime, Utc};
 use serde::{Deserialize, Serialize};
 use std::collections::VecDeque;
 use std::fs::{File, OpenOptions};
-use std::io::Write;
+use std::io::{BufWriter, Write};
 use std::path::PathBuf;
-use std::sync::{Arc, Mutex};
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::mpsc::{self, Receiver, SyncSender};
+use std::sync::{Arc, RwLock};
+use std::time::{Duration, Instant};
 
 /// Maximum number of traffic entries to keep in memory
 const MAX_TRAFFIC_HISTORY: usize = 1000;
@@ -132,24 +135,77 @@ pub fn get_log_file_path() -> PathBuf {
         .join("logs.txt")
 }
 
-/// Thread-safe traffic log
+/// Maximum events drained into one writer batch
+const WRITE_BATCH_MAX: usize = 256;
+
+/// At most one fsync per this interval; batches in between rely on
+/// buffered appends
+const FSYNC_INTERVAL: Duration = Duration::from_secs(1);
+
+/// Event pushed by the proxy hot path and applied by the writer task.
+/// Producers only allocate what the event itself owns; all log-line
+/// formatting and file I/O happens on the writer thread.
+enum LogEvent {
+    Start {
+        id: u64,
+        timestamp: DateTime<Utc>,
+        request: ApiRequest,
+    },
+    Complete {
+        id: u64,
+        response: ApiResponse,
+        latency_ms: u64,
+    },
+    Fail {
+        id: u64,
+        error: String,
+    },
+    Streaming {
+        id: u64,
+    },
+    EnableFile(File),
+    /// Barrier: acked once every event queued before it is applied
+    Flush(SyncSender<()>),
+}
+
+/// In-memory view maintained by the writer task. Readers take the read
+/// lock on a consistent snapshot; producers never touch this lock.
+struct LogState {
+    entries: VecDeque<TrafficEntry>,
+    stats: TrafficStats,
+}
+
+/// Thread-safe traffic log.
+///
+/// The request path (`start_request`/`complete_request`/`fail_request`)
+/// is an atomic id bump plus a channel push; a dedicated writer task
+/// drains events in batches, updates the in-memory state, and appends
+/// formatted lines to the log file through a buffered writer with
+/// periodic fsync.
 #[derive(Clone)]
 pub struct TrafficLog {
-    entries: Arc<Mutex<VecDeque<TrafficEntry>>>,
-    next_id: Arc<Mutex<u64>>,
-    stats: Arc<Mutex<TrafficStats>>,
-    log_file: Arc<Mutex<Option<File>>>,
+    sender: mpsc::Sender<LogEvent>,
+    next_id: Arc<AtomicU64>,
+    state: Arc<RwLock<LogState>>,
     log_path: PathBuf,
 }
 
 impl TrafficLog {
     pub fn new() -> Self {
         let log_path = get_log_file_path();
+        let state = Arc::new(RwLock::new(LogState {
+            entries: VecDeque::with_capacity(MAX_TRAFFIC_HISTORY),
+            stats: TrafficStats::default(),
+        }));
+
+        let (sender, receiver) = mpsc::channel();
+        let writer_state = Arc::clone(&state);
+        std::thread::spawn(move || run_writer(receiver, writer_state));
+
         Self {
-            entries: Arc::new(Mutex::new(VecDeque::with_capacity(MAX_TRAFFIC_HISTORY))),
-            next_id: Arc::new(Mutex::new(1)),
-            stats: Arc::new(Mutex::new(TrafficStats::default())),
-            log_file: Arc::new(Mutex::new(None)),
+            sender,
+            next_id: Arc::new(AtomicU64::new(1)),
+            state,
             log_path,
         }
     }
@@ -166,23 +222,12 @@ impl TrafficLog {
             .append(true)
             .open(&self.log_path)?;
 
-        let mut log_file = self.log_file.lock().unwrap();
-        *log_file = Some(file);
+        let _ = self.sender.send(LogEvent::EnableFile(file));
 
         tracing::info!("Logging traffic to {:?}", self.log_path);
         Ok(())
     }
 
-    /// Write a line to the log file
-    fn write_log(&self, line: &str) {
-        if let Ok(mut guard) = self.log_file.lock() {
-            if let Some(file) = guard.as_mut() {
-                let _ = writeln!(file, "{}", line);
-                let _ = file.flush();
-            }
-        }
-    }
-
     /// Get the log file path
     pub fn get_log_path(&self) -> &PathBuf {
         &self.log_path
@@ -190,162 +235,62 @@ impl TrafficLog {
 
     /// Start tracking a new request, returns entry ID
     pub fn start_request(&self, request: ApiRequest) -> u64 {
-        let mut next_id = self.next_id.lock().unwrap();
-        let id = *next_id;
-        *next_id += 1;
-
-        let timestamp = Utc::now();
-        let entry = TrafficEntry {
-            id,
-            timestamp,
-            request: request.clone(),
-            response: None,
-            latency_ms: None,
-            status: TrafficStatus::Pending,
-        };
-
-        // Log to file
-        self.write_log(&format!(
-            "[{}] REQUEST #{} model={} stream={} messages={}",
-            timestamp.format("%Y-%m-%d %H:%M:%S"),
+        let id = self.next_id.fetch_add(1, Ordering::Relaxed);
+        let _ = self.sender.send(LogEvent::Start {
             id,
-            request.model,
-            request.stream,
-            request.messages.len()
-        ));
-
-        let mut entries = self.entries.lock().unwrap();
-        if entries.len() >= MAX_TRAFFIC_HISTORY {
-            entries.pop_front();
-        }
-        entries.push_back(entry);
-
-        let mut stats = self.stats.lock().unwrap();
-        stats.total_requests += 1;
-
+            timestamp: Utc::now(),
+            request,
+        });
         id
     }
 
     /// Complete a request with response
     pub fn complete_request(&self, id: u64, response: ApiResponse, latency_ms: u64) {
-        // First, get info for logging without holding the lock
-        let log_info = {
-            let entries = self.entries.lock().unwrap();
-            entries.iter().find(|e| e.id == id).map(|entry| {
-                let usage = response.usage.as_ref();
-                let model = response.model.as_deref().unwrap_or(&entry.request.model);
-                let cost = usage.map(|u| calculate_cost(model, u)).unwrap_or(0.0);
-                (
-                    model.to_string(),
-                    usage.map(|u| u.input_tokens).unwrap_or(0),
-                    usage.map(|u| u.output_tokens).unwrap_or(0),
-                    cost,
-                )
-            })
-        };
-
-        // Log to file
-        if let Some((model, input, output, cost)) = log_info {
-            self.write_log(&format!(
-                "[{}] RESPONSE #{} model={} in={} out={} latency={}ms cost=${:.6}",
-                Utc::now().format("%Y-%m-%d %H:%M:%S"),
-                id,
-                model,
-                input,
-                output,
-                latency_ms,
-                cost
-            ));
-        }
-
-        // Now update entries and stats
-        let mut entries = self.entries.lock().unwrap();
-        if let Some(entry) = entries.iter_mut().find(|e| e.id == id) {
-            entry.response = Some(response.clone());
-            entry.latency_ms = Some(latency_ms);
-            entry.status = TrafficStatus::Success;
-        }
-
-        // Update stats
-        let mut stats = self.stats.lock().unwrap();
-        stats.successful_requests += 1;
-
-        if let Some(usage) = &response.usage {
-            stats.total_input_tokens += usage.input_tokens;
-            stats.total_output_tokens += usage.output_tokens;
-            stats.total_cache_read_tokens += usage.cache_read_input_tokens;
-            stats.total_cache_write_tokens += usage.cache_creation_input_tokens;
-
-            // Calculate cost based on model
-            if let Some(entry) = entries.iter().find(|e| e.id == id) {
-                let model = response.model.as_deref().unwrap_or(&entry.request.model);
-                stats.total_cost_usd += calculate_cost(model, usage);
-            }
-        }
-
-        // Update model usage
-        if let Some(model) = response.model {
-            if !model.is_empty() {
-                *stats.models_used.entry(model).or_insert(0) += 1;
-            }
-        }
-
-        // Update average latency
-        let total_latency: u64 = entries
-            .iter()
-            .filter_map(|e| e.latency_ms)
-            .sum();
-        let count = entries.iter().filter(|e| e.latency_ms.is_some()).count();
-        if count > 0 {
-            stats.avg_latency_ms = total_latency as f64 / count as f64;
-        }
+        let _ = self.sender.send(LogEvent::Complete {
+            id,
+            response,
+            latency_ms,
+        });
     }
 
     /// Mark request as failed
     pub fn fail_request(&self, id: u64, error: String) {
-        // Log to file
-        self.write_log(&format!(
-            "[{}] ERROR #{} {}",
-            Utc::now().format("%Y-%m-%d %H:%M:%S"),
-            id,
-            error
-        ));
-
-        let mut entries = self.entries.lock().unwrap();
-        if let Some(entry) = entries.iter_mut().find(|e| e.id == id) {
-            entry.status = TrafficStatus::Error(error);
-
-            let mut stats = self.stats.lock().unwrap();
-            stats.failed_requests += 1;
-        }
+        let _ = self.sender.send(LogEvent::Fail { id, error });
     }
 
     /// Mark request as streaming
     pub fn mark_streaming(&self, id: u64) {
-        let mut entries = self.entries.lock().unwrap();
-        if let Some(entry) = entries.iter_mut().find(|e| e.id == id) {
-            entry.status = TrafficStatus::Streaming;
+        let _ = self.sender.send(LogEvent::Streaming { id });
+    }
 
-            let mut stats = self.stats.lock().unwrap();
-            stats.streaming_requests += 1;
+    /// Wait until every event queued so far has been applied, so readers
+    /// observe their own writes
+    fn drain_pending(&self) {
+        let (ack_tx, ack_rx) = mpsc::sync_channel(1);
+        if self.sender.send(LogEvent::Flush(ack_tx)).is_ok() {
+            let _ = ack_rx.recv();
         }
     }
 
     /// Get recent entries (newest first)
     pub fn get_recent(&self, limit: usize) -> Vec<TrafficEntry> {
-        let entries = self.entries.lock().unwrap();
-        entries.iter().rev().take(limit).cloned().collect()
+        self.drain_pending();
+        let state = self.state.read().unwrap();
+        state.entries.iter().rev().take(limit).cloned().collect()
     }
 
     /// Get current stats
     pub fn get_stats(&self) -> TrafficStats {
-        self.stats.lock().unwrap().clone()
+        self.drain_pending();
+        self.state.read().unwrap().stats.clone()
     }
 
     /// Export all entries as JSON
     pub fn export_jsonl(&self) -> String {
-        let entries = self.entries.lock().unwrap();
-        entries
+        self.drain_pending();
+        let state = self.state.read().unwrap();
+        state
+            .entries
             .iter()
             .map(|e| serde_json::to_string(e).unwrap_or_default())
             .collect::<Vec<_>>()
@@ -353,6 +298,173 @@ impl TrafficLog {
     }
 }
 
+/// Writer task: drains events in batches, applies them to the shared
+/// state, and appends the formatted log lines in one buffered write.
+/// Exits when every `TrafficLog` handle has been dropped.
+fn run_writer(receiver: Receiver<LogEvent>, state: Arc<RwLock<LogState>>) {
+    let mut file: Option<BufWriter<File>> = None;
+    let mut last_sync = Instant::now();
+    let mut batch = Vec::with_capacity(WRITE_BATCH_MAX);
+    let mut lines = String::new();
+
+    while let Ok(first) = receiver.recv() {
+        batch.push(first);
+        while batch.len() < WRITE_BATCH_MAX {
+            match receiver.try_recv() {
+                Ok(event) => batch.push(event),
+                Err(_) => break,
+            }
+        }
+
+        lines.clear();
+        {
+            let mut state = state.write().unwrap();
+            for event in batch.drain(..) {
+                match event {
+                    LogEvent::EnableFile(f) => file = Some(BufWriter::new(f)),
+                    LogEvent::Flush(ack) => {
+                        // Events queued before the barrier are applied;
+                        // the reader may proceed
+                        let _ = ack.send(());
+                    }
+                    other => apply_event(&mut state, other, &mut lines),
+                }
+            }
+        }
+
+        if let Some(writer) = file.as_mut() {
+            if !lines.is_empty() {
+                let _ = writer.write_all(lines.as_bytes());
+                let _ = writer.flush();
+
+                if last_sync.elapsed() >= FSYNC_INTERVAL {
+                    let _ = writer.get_ref().sync_data();
+                    last_sync = Instant::now();
+                }
+            }
+        }
+    }
+}
+
+/// Applies one event to the in-memory state and appends its log line
+fn apply_event(state: &mut LogState, event: LogEvent, lines: &mut String) {
+    match event {
+        LogEvent::Start {
+            id,
+            timestamp,
+            request,
+        } => {
+            lines.push_str(&format!(
+                "[{}] REQUEST #{} model={} stream={} messages={}\n",
+                timestamp.format("%Y-%m-%d %H:%M:%S"),
+                id,
+                request.model,
+                request.stream,
+                request.messages.len()
+            ));
+
+            if state.entries.len() >= MAX_TRAFFIC_HISTORY {
+                state.entries.pop_front();
+            }
+            state.entries.push_back(TrafficEntry {
+                id,
+                timestamp,
+                request,
+                response: None,
+                latency_ms: None,
+                status: TrafficStatus::Pending,
+            });
+
+            state.stats.total_requests += 1;
+        }
+
+        LogEvent::Complete {
+            id,
+            response,
+            latency_ms,
+        } => {
+            if let Some(entry) = state.entries.iter().find(|e| e.id == id) {
+                let usage = response.usage.as_ref();
+                let model = response.model.as_deref().unwrap_or(&entry.request.model);
+                let cost = usage.map(|u| calculate_cost(model, u)).unwrap_or(0.0);
+                lines.push_str(&format!(
+                    "[{}] RESPONSE #{} model={} in={} out={} latency={}ms cost=${:.6}\n",
+                    Utc::now().format("%Y-%m-%d %H:%M:%S"),
+                    id,
+                    model,
+                    usage.map(|u| u.input_tokens).unwrap_or(0),
+                    usage.map(|u| u.output_tokens).unwrap_or(0),
+                    latency_ms,
+                    cost
+                ));
+            }
+
+            if let Some(entry) = state.entries.iter_mut().find(|e| e.id == id) {
+                entry.response = Some(response.clone());
+                entry.latency_ms = Some(latency_ms);
+                entry.status = TrafficStatus::Success;
+            }
+
+            state.stats.successful_requests += 1;
+
+            if let Some(usage) = &response.usage {
+                state.stats.total_input_tokens += usage.input_tokens;
+                state.stats.total_output_tokens += usage.output_tokens;
+                state.stats.total_cache_read_tokens += usage.cache_read_input_tokens;
+                state.stats.total_cache_write_tokens += usage.cache_creation_input_tokens;
+
+                // Calculate cost based on model
+                if let Some(entry) = state.entries.iter().find(|e| e.id == id) {
+                    let model = response.model.as_deref().unwrap_or(&entry.request.model);
+                    state.stats.total_cost_usd += calculate_cost(model, usage);
+                }
+            }
+
+            // Update model usage
+            if let Some(model) = response.model {
+                if !model.is_empty() {
+                    *state.stats.models_used.entry(model).or_insert(0) += 1;
+                }
+            }
+
+            // Update average latency
+            let total_latency: u64 = state.entries.iter().filter_map(|e| e.latency_ms).sum();
+            let count = state
+                .entries
+                .iter()
+                .filter(|e| e.latency_ms.is_some())
+                .count();
+            if count > 0 {
+                state.stats.avg_latency_ms = total_latency as f64 / count as f64;
+            }
+        }
+
+        LogEvent::Fail { id, error } => {
+            lines.push_str(&format!(
+                "[{}] ERROR #{} {}\n",
+                Utc::now().format("%Y-%m-%d %H:%M:%S"),
+                id,
+                error
+            ));
+
+            if let Some(entry) = state.entries.iter_mut().find(|e| e.id == id) {
+                entry.status = TrafficStatus::Error(error);
+                state.stats.failed_requests += 1;
+            }
+        }
+
+        LogEvent::Streaming { id } => {
+            if let Some(entry) = state.entries.iter_mut().find(|e| e.id == id) {
+                entry.status = TrafficStatus::Streaming;
+                state.stats.streaming_requests += 1;
+            }
+        }
+
+        // Handled by the writer loop before applying state changes
+        LogEvent::EnableFile(_) | LogEvent::Flush(_) => {}
+    }
+}
+
 impl Default for TrafficLog {
     fn default() -> Self {
         Self::new()
@@ -3,6 +3,7 @@ use crate::analyzer::ConversationAnalyzer;
 use crate::claude_code_parser::ClaudeCodeParser;
 use crate::discovery::LogDiscovery;
 use crate::models::DiscoveryFindings;
+use crate::stats_engine::StatsEngine;
 use crate::timeline::{Timeline, TimelineAnalyzer};
 use crate::viral_insights::{ViralAnalyzer, ViralInsights};
 use anyhow::Result;
@@ -78,11 +79,16 @@ pub struct App {
     pub start_time: Instant,
     pub current_branch: String,
     pub scroll_offset: usize,
+    /// Incremental stats engine; None when the watcher could not start,
+    /// in which case update() falls back to full rescans
+    engine: Option<StatsEngine>,
 }
 
 impl App {
     pub fn new(base_dir: PathBuf) -> Self {
+        let engine = StatsEngine::new(base_dir.clone(), true).ok();
         Self {
+            engine,
             findings: None,
             insights: None,
             timeline: None,
@@ -113,26 +119,49 @@ impl App {
             .unwrap()
             .as_secs();
 
-        let discovery = LogDiscovery::new(self.base_dir.clone(), true);
-        let findings = discovery.scan()?;
+        if let Some(engine) = &self.engine {
+            // Counters are kept current by filesystem notifications;
+            // reading the snapshot costs a clone, not a corpus rescan
+            let stats = engine.snapshot();
 
-        self.tool_sizes.clear();
-        for loc in &findings.locations {
-            *self
-                .tool_sizes
-                .entry(loc.tool.name().to_string())
-                .or_insert(0) += loc.size_bytes;
-        }
-
-        self.estimated_tokens = findings.total_size_bytes / 4;
-        self.estimated_cost = (self.estimated_tokens as f64 / 1_000_000.0) * 12.0;
-
-        let analyzer = ConversationAnalyzer::new(self.base_dir.clone());
-        if let Ok(stats) = analyzer.analyze() {
+            self.tool_sizes = stats.tool_sizes.clone();
+            self.estimated_tokens = stats.estimated_tokens;
+            self.estimated_cost = (self.estimated_tokens as f64 / 1_000_000.0) * 12.0;
             self.total_conversations = stats.total_conversations;
             self.total_messages = stats.total_messages;
-            self.estimated_tokens = stats.total_tokens_estimate;
+
+            // The render functions only read the aggregate fields
+            self.findings = Some(DiscoveryFindings {
+                locations: Vec::new(),
+                total_size_bytes: stats.total_size_bytes,
+                total_files: stats.total_files,
+                tools_found: Vec::new(),
+            });
+        } else {
+            // Watcher unavailable: fall back to a full rescan per tick
+            let discovery = LogDiscovery::new(self.base_dir.clone(), true);
+            let findings = discovery.scan()?;
+
+            self.tool_sizes.clear();
+            for loc in &findings.locations {
+                *self
+                    .tool_sizes
+                    .entry(loc.tool.name().to_string())
+                    .or_insert(0) += loc.size_bytes;
+            }
+
+            self.estimated_tokens = findings.total_size_bytes / 4;
             self.estimated_cost = (self.estimated_tokens as f64 / 1_000_000.0) * 12.0;
+
+            let analyzer = ConversationAnalyzer::new(self.base_dir.clone());
+            if let Ok(stats) = analyzer.analyze() {
+                self.total_conversations = stats.total_conversations;
+                self.total_messages = stats.total_messages;
+                self.estimated_tokens = stats.total_tokens_estimate;
+                self.estimated_cost = (self.estimated_tokens as f64 / 1_000_000.0) * 12.0;
+            }
+
+            self.findings = Some(findings);
         }
 
         self.update_git_context();
@@ -144,7 +173,6 @@ impl App {
             self.estimated_tokens,
         );
 
-        self.findings = Some(findings);
         self.update_count += 1;
 
         if self.update_count == 1 {
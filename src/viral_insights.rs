@@ -7,7 +7,7 @@ use std::path::PathBuf;
 use tracing::info;
 use walkdir::WalkDir;
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct ViralInsights {
     pub fun_facts: FunFacts,
     pub behavior_patterns: BehaviorPatterns,
@@ -18,7 +18,7 @@ pub struct ViralInsights {
     pub records: Records,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct FunFacts {
     pub tokens_in_books: f64,     // Equivalent number of novels
     pub tokens_in_wikipedia: f64, // Percentage of Wikipedia
@@ -28,7 +28,7 @@ pub struct FunFacts {
     pub cost_in_coffee: usize,    // Equivalent Starbucks coffees
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct BehaviorPatterns {
     pub frustration_count: usize,                  // "wtf", "no,", "please"
     pub go_on_count: usize,                        // Just "go on"
@@ -40,7 +40,7 @@ pub struct BehaviorPatterns {
     pub frustration_examples: Vec<String>,         // Actual frustrated messages
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct TimeAnalytics {
     pub hourly_heatmap: HashMap<usize, usize>, // Messages by hour (0-23)
     pub daily_heatmap: HashMap<String, usize>, // Messages by weekday
@@ -53,7 +53,7 @@ pub struct TimeAnalytics {
     pub average_session_gap_hours: f64,        // Time between sessions
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct CodeVelocity {
     pub lines_per_hour: f64,
     pub files_per_session: f64,
@@ -65,7 +65,7 @@ pub struct CodeVelocity {
     pub edit_to_create_ratio: f64,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct Achievement {
     pub name: String,
     pub description: String,
@@ -73,7 +73,7 @@ pub struct Achievement {
     pub emoji: String,
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct Comparisons {
     pub war_and_peace_equivalent: f64, // How many War & Peace novels
     pub harry_potter_series: f64,      // How many HP series
@@ -82,7 +82,7 @@ pub struct Comparisons {
     pub stackoverflow_answers: usize,  // Avg 500 tokens each
 }
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct Records {
     pub longest_session_messages: usize,
     pub longest_session_tokens: u64,
@@ -1,16 +1,16 @@
+use crate::conversation_store::{self, ConversationStore};
 use anyhow::Result;
 use chrono::{DateTime, Datelike, Timelike, Utc};
 use serde::{Deserialize, Serialize};
 use std::collections::HashMap;
-use std::fs;
 use std::path::PathBuf;
+use std::sync::Arc;
 use tracing::{debug, info};
-use walkdir::WalkDir;
 
 const SESSION_GAP_MINUTES: i64 = 30; // Gap > 30 min = new session
 const SESSION_BUFFER_MINUTES: i64 = 5; // Add 5 min before/after each session
 
-#[derive(Debug, Serialize)]
+#[derive(Debug, Serialize, Deserialize)]
 pub struct WorkHoursAnalysis {
     pub total_hours: f64,
     pub total_sessions: usize,
@@ -32,7 +32,7 @@ pub struct WorkHoursAnalysis {
     pub work_life_balance_score: f64, // 0-100, higher = better balance
 }
 
-#[derive(Debug, Serialize, Clone)]
+#[derive(Debug, Serialize, Deserialize, Clone)]
 pub struct SessionInfo {
     pub start_time: String,
     pub end_time: String,
@@ -68,12 +68,19 @@ struct MessageContent {
 }
 
 pub struct WorkHoursAnalyzer {
-    base_dir: PathBuf,
+    store: Arc<ConversationStore>,
 }
 
 impl WorkHoursAnalyzer {
     pub fn new(base_dir: PathBuf) -> Self {
-        Self { base_dir }
+        Self {
+            store: ConversationStore::build(&base_dir),
+        }
+    }
+
+    /// Reuses an already-built store instead of re-reading the corpus
+    pub fn with_store(store: Arc<ConversationStore>) -> Self {
+        Self { store }
     }
 
     pub fn analyze(&self) -> Result<WorkHoursAnalysis> {
@@ -97,149 +104,99 @@ impl WorkHoursAnalyzer {
     }
 
     fn parse_cline_sessions(&self, all_sessions: &mut Vec<SessionInfo>) -> Result<()> {
-        let patterns = vec![
-            ("Cline", ".config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks"),
-            ("Cline (Flatpak)", ".var/app/com.visualstudio.code/config/Code/User/globalStorage/saoudrizwan.claude-dev/tasks"),
-            ("Kilo", ".config/Code/User/globalStorage/kilocode.kilo-code/tasks"),
-            ("Roo-Cline", ".config/Code/User/globalStorage/rooveterinaryinc.roo-cline/tasks"),
-            ("Roo-Cline (Cursor)", ".config/Cursor/User/globalStorage/rooveterinaryinc.roo-cline/tasks"),
-        ];
-
-        for (tool_name, pattern) in patterns {
-            let path = self.base_dir.join(pattern);
-            if !path.exists() {
+        for task in &self.store.cline_tasks {
+            let messages: Vec<ClineMessage> = task
+                .messages
+                .iter()
+                .filter_map(conversation_store::view)
+                .collect();
+            if messages.is_empty() {
                 continue;
             }
 
-            for entry in WalkDir::new(&path)
-                .min_depth(1)
-                .max_depth(1)
-                .into_iter()
-                .filter_map(|e| e.ok())
-            {
-                if !entry.file_type().is_dir() {
-                    continue;
-                }
-
-                let api_history = entry.path().join("api_conversation_history.json");
-                if !api_history.exists() {
-                    continue;
-                }
+            // Count messages by role for session analysis
+            let user_msgs = messages.iter().filter(|m| m.role == "user").count();
+            let assistant_msgs = messages.iter().filter(|m| m.role == "assistant").count();
+            let total_chars: usize = messages.iter().map(|m| m.content.to_string().len()).sum();
 
-                if let Ok(file_content) = fs::read_to_string(&api_history) {
-                    if let Ok(messages) = serde_json::from_str::<Vec<ClineMessage>>(&file_content) {
-                        // Count messages by role for session analysis
-                        let user_msgs = messages.iter().filter(|m| m.role == "user").count();
-                        let assistant_msgs =
-                            messages.iter().filter(|m| m.role == "assistant").count();
-                        let total_chars: usize =
-                            messages.iter().map(|m| m.content.to_string().len()).sum();
-
-                        debug!(
-                            "Session has {} user msgs, {} assistant msgs, {} chars",
-                            user_msgs, assistant_msgs, total_chars
-                        );
-
-                        // Extract timestamps and group into sessions
-                        let mut timestamps: Vec<i64> =
-                            messages.iter().filter_map(|m| m.ts).collect();
-
-                        if timestamps.is_empty() {
-                            continue;
-                        }
+            debug!(
+                "Session has {} user msgs, {} assistant msgs, {} chars",
+                user_msgs, assistant_msgs, total_chars
+            );
 
-                        timestamps.sort();
+            // Extract timestamps and group into sessions
+            let mut timestamps: Vec<i64> = messages.iter().filter_map(|m| m.ts).collect();
 
-                        // Group into sessions based on gaps
-                        let sessions = self.group_into_sessions(&timestamps, tool_name, None);
-                        all_sessions.extend(sessions);
-                    }
-                }
+            if timestamps.is_empty() {
+                continue;
             }
+
+            timestamps.sort();
+
+            // Group into sessions based on gaps
+            let sessions = self.group_into_sessions(&timestamps, &task.tool, None);
+            all_sessions.extend(sessions);
         }
 
         Ok(())
     }
 
     fn parse_claude_sessions(&self, all_sessions: &mut Vec<SessionInfo>) -> Result<()> {
-        let projects_dir = self.base_dir.join(".claude/projects");
-        if !projects_dir.exists() {
-            return Ok(());
-        }
-
-        for entry in WalkDir::new(&projects_dir)
-            .into_iter()
-            .filter_map(|e| e.ok())
-        {
-            if !entry.file_type().is_file() {
-                continue;
-            }
-
-            let path = entry.path();
-            if let Some(ext) = path.extension() {
-                if ext != "jsonl" {
-                    continue;
-                }
-            } else {
-                continue;
-            }
-
-            if let Ok(file_content) = fs::read_to_string(path) {
-                let mut timestamps: Vec<(i64, Option<String>)> = Vec::new();
-                let mut user_msgs = 0;
-                let mut assistant_msgs = 0;
-                let mut total_content_size = 0usize;
+        for file in &self.store.claude_projects {
+            let mut timestamps: Vec<(i64, Option<String>)> = Vec::new();
+            let mut user_msgs = 0;
+            let mut assistant_msgs = 0;
+            let mut total_content_size = 0usize;
+
+            for line in &file.lines {
+                if let Some(msg) = conversation_store::view::<ClaudeMessage>(line) {
+                    // Track message types for analysis
+                    if msg.r#type == "user" || msg.r#type == "human" {
+                        user_msgs += 1;
+                    } else if msg.r#type == "assistant" {
+                        assistant_msgs += 1;
+                    }
 
-                for line in file_content.lines() {
-                    if let Ok(msg) = serde_json::from_str::<ClaudeMessage>(line) {
-                        // Track message types for analysis
-                        if msg.r#type == "user" || msg.r#type == "human" {
+                    // Also check nested message content for role and size
+                    if let Some(ref content) = msg.message {
+                        if content.role == "user" {
                             user_msgs += 1;
-                        } else if msg.r#type == "assistant" {
+                        } else if content.role == "assistant" {
                             assistant_msgs += 1;
                         }
+                        // Track content size for token estimation
+                        total_content_size += content.content.to_string().len();
+                    }
 
-                        // Also check nested message content for role and size
-                        if let Some(ref content) = msg.message {
-                            if content.role == "user" {
-                                user_msgs += 1;
-                            } else if content.role == "assistant" {
-                                assistant_msgs += 1;
-                            }
-                            // Track content size for token estimation
-                            total_content_size += content.content.to_string().len();
-                        }
-
-                        if let Some(ts_str) = msg.timestamp {
-                            // Parse ISO 8601 timestamp
-                            if let Ok(dt) = DateTime::parse_from_rfc3339(&ts_str) {
-                                let ts_millis = dt.timestamp_millis();
-                                timestamps.push((ts_millis, msg.cwd.clone()));
-                            }
+                    if let Some(ts_str) = msg.timestamp {
+                        // Parse ISO 8601 timestamp
+                        if let Ok(dt) = DateTime::parse_from_rfc3339(&ts_str) {
+                            let ts_millis = dt.timestamp_millis();
+                            timestamps.push((ts_millis, msg.cwd.clone()));
                         }
                     }
                 }
+            }
 
-                debug!(
-                    "Claude session: {} user msgs, {} assistant msgs, {} chars",
-                    user_msgs, assistant_msgs, total_content_size
-                );
+            debug!(
+                "Claude session: {} user msgs, {} assistant msgs, {} chars",
+                user_msgs, assistant_msgs, total_content_size
+            );
 
-                if timestamps.is_empty() {
-                    continue;
-                }
+            if timestamps.is_empty() {
+                continue;
+            }
 
-                timestamps.sort_by_key(|t| t.0);
+            timestamps.sort_by_key(|t| t.0);
 
-                // Extract just the timestamps for session grouping
-                let ts_only: Vec<i64> = timestamps.iter().map(|t| t.0).collect();
+            // Extract just the timestamps for session grouping
+            let ts_only: Vec<i64> = timestamps.iter().map(|t| t.0).collect();
 
-                // Get project from first message with cwd
-                let project = timestamps.iter().find_map(|t| t.1.clone());
+            // Get project from first message with cwd
+            let project = timestamps.iter().find_map(|t| t.1.clone());
 
-                let sessions = self.group_into_sessions(&ts_only, "Claude Code", project);
-                all_sessions.extend(sessions);
-            }
+            let sessions = self.group_into_sessions(&ts_only, "Claude Code", project);
+            all_sessions.extend(sessions);
         }
 
         Ok(())